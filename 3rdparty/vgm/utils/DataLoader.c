@@ -11,8 +11,10 @@ UINT8 DataLoader_Reset(DATA_LOADER *loader)
 	DataLoader_CancelLoading(loader);
 
 	if(loader->_data) {
-		free(loader->_data);
+		if(!loader->_dataExternal)
+			free(loader->_data);
 		loader->_data = NULL;
+		loader->_dataExternal = 0;
 		loader->_bytesLoaded = 0;
 	}
 
@@ -123,6 +125,16 @@ UINT32 DataLoader_Read(DATA_LOADER *loader, UINT32 numBytes)
 	return readBytes;
 }
 
+void DataLoader_Attach(DATA_LOADER *loader, const UINT8 *data, UINT32 size)
+{
+	DataLoader_Reset(loader);
+	loader->_data = (UINT8 *)data;
+	loader->_dataExternal = 1;
+	loader->_bytesTotal = size;
+	loader->_bytesLoaded = size;
+	loader->_status = DLSTAT_LOADED;
+}
+
 void DataLoader_Deinit(DATA_LOADER *dLoader)
 {
 	if(dLoader == NULL) return;
@@ -139,6 +151,7 @@ void DataLoader_Deinit(DATA_LOADER *dLoader)
 
 void DataLoader_Setup(DATA_LOADER *loader, const DATA_LOADER_CALLBACKS *callbacks, void *context) {
 	loader->_data = NULL;
+	loader->_dataExternal = 0;
 	loader->_status = DLSTAT_EMPTY;
 	loader->_readStopOfs = (UINT32)-1;
 	loader->_context = context;
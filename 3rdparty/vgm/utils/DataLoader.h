@@ -42,6 +42,7 @@ typedef struct _data_loader
 	UINT32 _bytesLoaded;
 	UINT32 _readStopOfs;
 	UINT8 *_data;
+	UINT8 _dataExternal;
 	const DATA_LOADER_CALLBACKS *_callbacks;
 	void *_context;
 } DATA_LOADER;
@@ -87,6 +88,9 @@ void DataLoader_ReadAll(DATA_LOADER *loader);
 /* convenience function for MemoryLoader,FileLoader, etc */
 void DataLoader_Setup(DATA_LOADER *loader, const DATA_LOADER_CALLBACKS *callbacks, void *context);
 
+/* sets external data in loaded state, it's neither copied nor freed by the loader */
+void DataLoader_Attach(DATA_LOADER *loader, const UINT8 *data, UINT32 size);
+
 /* tear-down function */
 void DataLoader_Deinit(DATA_LOADER *loader);
 
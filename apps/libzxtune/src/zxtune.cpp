@@ -13,60 +13,67 @@
 #include "../zxtune.h"
 // common includes
 #include <contract.h>
-#include <cycle_buffer.h>
 #include <error_tools.h>
 #include <make_ptr.h>
-#include <progress_callback.h>
 // library includes
 #include <binary/container.h>
 #include <binary/container_factories.h>
 #include <core/core_parameters.h>
-#include <core/module_open.h>
+#include <core/service.h>
+#include <math/scale.h>
 #include <module/holder.h>
+#include <module/players/pipeline.h>
+#include <module/track_information.h>
 #include <parameters/container.h>
+#include <parameters/tracking_helper.h>
 #include <platform/version/api.h>
+#include <sound/render_params.h>
 #include <sound/sound_parameters.h>
 // std includes
-#include <map>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
 
-namespace Text
+namespace Platform::Version
 {
-  extern const Char PROGRAM_NAME[] = {'l', 'i', 'b', 'z', 'x', 't', 'u', 'n', 'e', 0};
+  extern const Char PROGRAM_NAME[] = "libzxtune";
 }
 
 namespace
 {
-  template<class ObjPtrType>
-  struct ObjectTraits
-  {
-    static ZXTuneHandle GetHandle(ObjPtrType obj)
-    {
-      return reinterpret_cast<ZXTuneHandle>(obj.get());
-    }
-  };
-
+  /*
+    Handle layout (from LSB):
+    - shard index
+    - slot index in shard
+    - slot generation (never zero, so handle is never zero too)
+  */
   template<class PtrType>
   class HandlesCache
   {
   public:
     ZXTuneHandle Add(PtrType val)
     {
-      const ZXTuneHandle result = ObjectTraits<PtrType>::GetHandle(val);
-      Require(result != ZXTuneHandle());
-      Require(Handles.insert(typename Handle2Object::value_type(result, val)).second);
-      return result;
+      Require(!!val);
+      const auto shard = NextShard.fetch_add(1, std::memory_order_relaxed) % SHARDS_COUNT;
+      const auto slot = Shards[shard].Add(std::move(val));
+      return ToHandle((((slot.Generation << INDEX_BITS) | slot.Index) << SHARD_BITS) | shard);
     }
 
     void Delete(ZXTuneHandle handle)
     {
-      Handles.erase(handle);
+      // object is destroyed outside of shard lock
+      const auto raw = FromHandle(handle);
+      const auto obj = Shards[raw & SHARD_MASK].Fetch(raw >> SHARD_BITS);
     }
 
     PtrType Get(ZXTuneHandle handle) const
     {
-      const typename Handle2Object::const_iterator it = Handles.find(handle);
-      Require(it != Handles.end());
-      return it->second;
+      const auto raw = FromHandle(handle);
+      auto result = Shards[raw & SHARD_MASK].Get(raw >> SHARD_BITS);
+      Require(!!result);
+      return result;
     }
 
     static HandlesCache<PtrType>& Instance()
@@ -76,8 +83,113 @@ namespace
     }
 
   private:
-    typedef std::map<ZXTuneHandle, PtrType> Handle2Object;
-    Handle2Object Handles;
+    using RawHandle = std::uintptr_t;
+
+    static const uint_t SHARD_BITS = 4;
+    static const std::size_t SHARDS_COUNT = std::size_t(1) << SHARD_BITS;
+    static const RawHandle SHARD_MASK = SHARDS_COUNT - 1;
+    static const uint_t INDEX_BITS = 16;
+    static const std::size_t MAX_SLOTS = std::size_t(1) << INDEX_BITS;
+    static const RawHandle INDEX_MASK = MAX_SLOTS - 1;
+    static const RawHandle GENERATION_MASK = ~RawHandle(0) >> (SHARD_BITS + INDEX_BITS);
+
+    static ZXTuneHandle ToHandle(RawHandle raw)
+    {
+      return reinterpret_cast<ZXTuneHandle>(raw);
+    }
+
+    static RawHandle FromHandle(ZXTuneHandle handle)
+    {
+      return reinterpret_cast<RawHandle>(handle);
+    }
+
+    struct SlotId
+    {
+      RawHandle Generation;
+      RawHandle Index;
+    };
+
+    class Shard
+    {
+    public:
+      SlotId Add(PtrType val)
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        RawHandle idx = 0;
+        if (Free.empty())
+        {
+          Require(Slots.size() < MAX_SLOTS);
+          idx = Slots.size();
+          Slots.emplace_back();
+        }
+        else
+        {
+          idx = Free.back();
+          Free.pop_back();
+        }
+        auto& slot = Slots[idx];
+        slot.Object = std::move(val);
+        return {slot.Generation, idx};
+      }
+
+      PtrType Get(RawHandle id) const
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        if (const auto* slot = Find(id))
+        {
+          return slot->Object;
+        }
+        return {};
+      }
+
+      PtrType Fetch(RawHandle id)
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        if (auto* slot = const_cast<Slot*>(Find(id)))
+        {
+          auto result = std::move(slot->Object);
+          slot->Object = PtrType();
+          slot->Generation = (slot->Generation + 1) & GENERATION_MASK;
+          if (!slot->Generation)
+          {
+            slot->Generation = 1;
+          }
+          Free.push_back(id & INDEX_MASK);
+          return result;
+        }
+        return {};
+      }
+
+    private:
+      struct Slot
+      {
+        PtrType Object;
+        RawHandle Generation = 1;
+      };
+
+      const Slot* Find(RawHandle id) const
+      {
+        const auto idx = id & INDEX_MASK;
+        if (idx < Slots.size())
+        {
+          const auto& slot = Slots[idx];
+          if (slot.Object && slot.Generation == (id >> INDEX_BITS))
+          {
+            return &slot;
+          }
+        }
+        return nullptr;
+      }
+
+    private:
+      mutable std::mutex Guard;
+      std::vector<Slot> Slots;
+      std::vector<RawHandle> Free;
+    };
+
+  private:
+    std::array<Shard, SHARDS_COUNT> Shards;
+    std::atomic<std::size_t> NextShard = 0;
   };
 
   typedef HandlesCache<Binary::Container::Ptr> ContainersCache;
@@ -87,151 +199,147 @@ namespace
   static_assert(Sound::Sample::BITS == 16, "Incompatible sound sample bits count");
   static_assert(Sound::Sample::MID == 0, "Incompatible sound sample type");
 
-  class BufferRender : public Sound::Receiver
+  // Tail of the last rendered chunk not fit into client's buffer
+  class PendingSamples
   {
   public:
-    typedef std::shared_ptr<BufferRender> Ptr;
-
-    BufferRender()
-      : Buffer(32768)
-      , DoneSamples()
-    {}
-
-    void ApplyData(Sound::Chunk data) override
-    {
-      Buffer.Put(data.begin(), data.size());
-    }
-
-    void Flush() override {}
-
-    std::size_t GetCurrentSample() const
+    std::size_t Get(Sound::Sample* target, std::size_t count)
     {
-      return DoneSamples;
-    }
-
-    std::size_t GetSamples(std::size_t count, Sound::Sample* target)
-    {
-      const Sound::Sample* part1 = 0;
-      std::size_t part1Size = 0;
-      const Sound::Sample* part2 = 0;
-      std::size_t part2Size = 0;
-      if (const std::size_t toGet = Buffer.Peek(count, part1, part1Size, part2, part2Size))
+      const auto toCopy = std::min(count, Data.size() - Offset);
+      if (toCopy)
       {
-        std::memcpy(target, part1, part1Size * sizeof(*part1));
-        if (part2)
-        {
-          std::memcpy(target + part1Size, part2, part2Size * sizeof(*part2));
-        }
-        Buffer.Consume(toGet);
-        DoneSamples += toGet;
-        return toGet;
+        std::memcpy(target, Data.data() + Offset, toCopy * sizeof(*target));
+        Offset += toCopy;
       }
-      return 0;
+      return toCopy;
     }
 
-    std::size_t DropSamples(std::size_t count)
+    void Set(Sound::Chunk data, std::size_t offset)
     {
-      const std::size_t toDrop = Buffer.Consume(count);
-      DoneSamples += toDrop;
-      return toDrop;
+      Data = std::move(data);
+      Offset = offset;
     }
 
     void Reset()
     {
-      Buffer.Reset();
-      DoneSamples = 0;
+      Data = Sound::Chunk();
+      Offset = 0;
     }
 
   private:
-    CycleBuffer<Sound::Sample> Buffer;
-    std::size_t DoneSamples;
+    Sound::Chunk Data;
+    std::size_t Offset = 0;
   };
 
+  // Calls for the same player are serialized
   class PlayerWrapper
   {
   public:
     typedef std::shared_ptr<PlayerWrapper> Ptr;
 
-    PlayerWrapper(Parameters::Container::Ptr params, Module::Renderer::Ptr renderer, BufferRender::Ptr buffer)
-      : Params(params)
-      , Renderer(renderer)
-      , Buffer(buffer)
+    PlayerWrapper(Parameters::Container::Ptr params, Module::Renderer::Ptr renderer, uint_t samplerate)
+      : Params(std::move(params))
+      , Props(Params)
+      , Renderer(std::move(renderer))
+      , State(Renderer->GetState())
+      , Samplerate(samplerate)
     {}
 
     std::size_t RenderSound(Sound::Sample* target, std::size_t samples)
     {
-      std::size_t result = 0;
-      while (samples)
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (Props.IsChanged())
+      {
+        Looped = Sound::GetLoopParameters(*Props);
+      }
+      auto done = Rest.Get(target, samples);
+      while (done < samples)
       {
-        const std::size_t got = Buffer->GetSamples(samples, target);
-        target += got;
-        samples -= got;
-        result += got;
-        if (0 == samples || !Renderer->RenderFrame())
+        auto chunk = Renderer->Render(Looped);
+        if (chunk.empty())
         {
           break;
         }
+        // render directly to client's buffer, keep only tail
+        const auto toCopy = std::min(chunk.size(), samples - done);
+        std::memcpy(target + done, chunk.data(), toCopy * sizeof(*target));
+        done += toCopy;
+        if (toCopy != chunk.size())
+        {
+          Rest.Set(std::move(chunk), toCopy);
+        }
       }
-      return result;
+      DoneSamples += done;
+      return done;
     }
 
     std::size_t Seek(std::size_t samples)
     {
-      if (samples < Buffer->GetCurrentSample())
-      {
-        Reset();
-      }
-      while (samples != Buffer->GetCurrentSample())
-      {
-        const std::size_t toDrop = samples - Buffer->GetCurrentSample();
-        if (const std::size_t dropped = Buffer->DropSamples(toDrop))
-        {
-          continue;
-        }
-        if (!Renderer->RenderFrame())
-        {
-          break;
-        }
-      }
-      return Buffer->GetCurrentSample();
+      const std::lock_guard<std::mutex> lock(Guard);
+      const auto request = Time::Milliseconds::FromRatio(samples, Samplerate);
+      Renderer->SetPosition(Time::AtMillisecond(request.Get()));
+      Rest.Reset();
+      // position is aligned by renderer
+      DoneSamples = Math::Scale(uint64_t(State->At().Get()), uint64_t(Time::Milliseconds::PER_SECOND), uint64_t(Samplerate));
+      return static_cast<std::size_t>(DoneSamples);
     }
 
     void Reset()
     {
+      const std::lock_guard<std::mutex> lock(Guard);
       Renderer->Reset();
-      Buffer->Reset();
+      Rest.Reset();
+      DoneSamples = 0;
     }
 
-    Parameters::Container::Ptr GetParameters() const
+    bool FindParameter(const Parameters::Identifier& name, Parameters::IntType& value) const
     {
-      return Params;
+      const std::lock_guard<std::mutex> lock(Guard);
+      return Params->FindValue(name, value);
+    }
+
+    void SetParameter(const Parameters::Identifier& name, Parameters::IntType value)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      Params->SetValue(name, value);
     }
 
     static Ptr Create(Module::Holder::Ptr holder)
     {
-      const Parameters::Container::Ptr params = Parameters::Container::Create();
+      auto params = Parameters::Container::Create();
       // copy initial properties
       holder->GetModuleProperties()->Process(*params);
-      const BufferRender::Ptr buffer = MakePtr<BufferRender>();
-      const Module::Renderer::Ptr renderer = holder->CreateRenderer(params, buffer);
-      return MakePtr<PlayerWrapper>(params, renderer, buffer);
+      const auto samplerate = Sound::GetSoundFrequency(*params);
+      auto renderer = Module::CreatePipelinedRenderer(*holder, samplerate, params);
+      return MakePtr<PlayerWrapper>(std::move(params), std::move(renderer), samplerate);
     }
 
   private:
     const Parameters::Container::Ptr Params;
+    Parameters::TrackingHelper<Parameters::Accessor> Props;
     const Module::Renderer::Ptr Renderer;
-    const BufferRender::Ptr Buffer;
+    const Module::State::Ptr State;
+    const uint_t Samplerate;
+    mutable std::mutex Guard;
+    Sound::LoopParameters Looped;
+    PendingSamples Rest;
+    uint64_t DoneSamples = 0;
   };
 
   typedef HandlesCache<PlayerWrapper::Ptr> PlayersCache;
 
-  bool FindDefaultValue(const Parameters::NameType& name, Parameters::IntType& value)
+  const ZXTune::Service& GetService()
+  {
+    static const auto instance = ZXTune::Service::Create(Parameters::Container::Create());
+    return *instance;
+  }
+
+  bool FindDefaultValue(const Parameters::Identifier& name, Parameters::IntType& value)
   {
-    typedef std::pair<Parameters::NameType, Parameters::IntType> Name2Val;
+    typedef std::pair<Parameters::Identifier, Parameters::IntType> Name2Val;
     static const Name2Val DEFAULTS[] = {
         Name2Val(Parameters::ZXTune::Sound::FREQUENCY, Parameters::ZXTune::Sound::FREQUENCY_DEFAULT),
         Name2Val(Parameters::ZXTune::Core::AYM::CLOCKRATE, Parameters::ZXTune::Core::AYM::CLOCKRATE_DEFAULT),
-        Name2Val(Parameters::ZXTune::Sound::FRAMEDURATION, Parameters::ZXTune::Sound::FRAMEDURATION_DEFAULT),
     };
     for (const auto& def : DEFAULTS)
     {
@@ -255,7 +363,7 @@ ZXTuneHandle ZXTune_CreateData(const void* data, size_t size)
 {
   try
   {
-    const Binary::Container::Ptr result = Binary::CreateContainer(data, size);
+    const Binary::Container::Ptr result = Binary::CreateContainer(Binary::View(data, size));
     return ContainersCache::Instance().Add(result);
   }
   catch (const std::exception&)
@@ -273,10 +381,9 @@ ZXTuneHandle ZXTune_OpenModule(ZXTuneHandle data)
 {
   try
   {
-    const Parameters::Container::Ptr params = Parameters::Container::Create();
-    const Binary::Container::Ptr src = ContainersCache::Instance().Get(data);
-    const Module::Holder::Ptr result = Module::Open(*params, *src);
-    return ModulesCache::Instance().Add(result);
+    auto src = ContainersCache::Instance().Get(data);
+    auto result = GetService().OpenModule(std::move(src), {}, Parameters::Container::Create());
+    return ModulesCache::Instance().Add(std::move(result));
   }
   catch (const Error&)
   {
@@ -300,11 +407,23 @@ bool ZXTune_GetModuleInfo(ZXTuneHandle module, ZXTuneModuleInfo* info)
     Require(info != 0);
     const Module::Holder::Ptr holder = ModulesCache::Instance().Get(module);
     const Module::Information::Ptr modinfo = holder->GetModuleInformation();
-    info->Positions = modinfo->PositionsCount();
-    info->LoopPosition = modinfo->LoopPosition();
-    info->Frames = modinfo->FramesCount();
-    info->LoopFrame = modinfo->LoopFrame();
-    info->Channels = modinfo->ChannelsCount();
+    // frames are measured in default 50Hz units
+    static const auto FRAME_DURATION = Time::Milliseconds::FromFrequency(50);
+    const auto duration = modinfo->Duration();
+    info->Frames = duration.Divide<int>(FRAME_DURATION);
+    info->LoopFrame = (duration.Get() - modinfo->LoopDuration().Get()) / FRAME_DURATION.Get();
+    if (const auto trackInfo = std::dynamic_pointer_cast<const Module::TrackInformation>(modinfo))
+    {
+      info->Positions = trackInfo->PositionsCount();
+      info->LoopPosition = trackInfo->LoopPosition();
+      info->Channels = trackInfo->ChannelsCount();
+    }
+    else
+    {
+      info->Positions = 1;
+      info->LoopPosition = 0;
+      info->Channels = 0;
+    }
     return true;
   }
   catch (const Error&)
@@ -399,10 +518,9 @@ bool ZXTune_GetPlayerParameterInt(ZXTuneHandle player, const char* paramName, in
   {
     Require(paramValue != 0);
     const PlayerWrapper::Ptr wrapper = PlayersCache::Instance().Get(player);
-    const Parameters::Accessor::Ptr props = wrapper->GetParameters();
-    const Parameters::NameType name(paramName);
+    const Parameters::Identifier name(paramName);
     Parameters::IntType value;
-    if (!props->FindValue(name, value) && !FindDefaultValue(name, value))
+    if (!wrapper->FindParameter(name, value) && !FindDefaultValue(name, value))
     {
       return false;
     }
@@ -424,9 +542,8 @@ bool ZXTune_SetPlayerParameterInt(ZXTuneHandle player, const char* paramName, in
   try
   {
     const PlayerWrapper::Ptr wrapper = PlayersCache::Instance().Get(player);
-    const Parameters::Modifier::Ptr props = wrapper->GetParameters();
-    const Parameters::NameType name(paramName);
-    props->SetValue(name, paramValue);
+    const Parameters::Identifier name(paramName);
+    wrapper->SetParameter(name, paramValue);
     return true;
   }
   catch (const Error&)
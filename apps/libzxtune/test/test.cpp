@@ -8,16 +8,18 @@
  *
  **/
 
-#include "zxtune.h"
+#include "../zxtune.h"
 #include <contract.h>
 #include <fstream>
 #include <iostream>
 #include <pointers.h>
+#include <thread>
 #include <types.h>
+#include <vector>
 
 namespace
 {
-  void OpenFile(const std::string& name, Dump& result)
+  void OpenFile(const std::string& name, std::vector<uint8_t>& result)
   {
     std::ifstream stream(name.c_str(), std::ios::binary);
     if (!stream)
@@ -27,11 +29,22 @@ namespace
     stream.seekg(0, std::ios_base::end);
     const std::size_t size = stream.tellg();
     stream.seekg(0);
-    Dump tmp(size);
+    std::vector<uint8_t> tmp(size);
     stream.read(safe_ptr_cast<char*>(&tmp[0]), tmp.size());
     result.swap(tmp);
     // std::cout << "Read " << size << " bytes from " << name << std::endl;
   }
+
+  void TestPlayer(ZXTuneHandle player)
+  {
+    std::vector<int16_t> buffer(2 * 10000);
+    const int rendered = ZXTune_RenderSound(player, buffer.data(), 10000);
+    Require(rendered == 10000);
+    const int pos = ZXTune_SeekSound(player, 441000);
+    Require(pos > 0 && pos <= 441000);
+    Require(ZXTune_RenderSound(player, buffer.data(), 10000) == 10000);
+    Require(ZXTune_ResetSound(player));
+  }
 }  // namespace
 
 int main(int argc, char* argv[])
@@ -42,7 +55,7 @@ int main(int argc, char* argv[])
     std::cout << "Testing for " << version << std::endl;
     const char* const path = argc > 1 ? argv[1] : "../../../samples/chiptunes/AY-3-8910/pt3/Lat_mix2.pt3";
     std::cout << "Opening data" << std::endl;
-    Dump dump;
+    std::vector<uint8_t> dump;
     OpenFile(path, dump);
     Require(dump.size() != 0);
     std::cout << "Creating data" << std::endl;
@@ -54,6 +67,32 @@ int main(int argc, char* argv[])
     std::cout << "Creating player" << std::endl;
     ZXTuneHandle player = ZXTune_CreatePlayer(module);
     Require(player);
+    std::cout << "Rendering" << std::endl;
+    TestPlayer(player);
+    std::cout << "Rendering concurrently" << std::endl;
+    {
+      std::vector<std::thread> threads;
+      for (uint_t idx = 0; idx != 4; ++idx)
+      {
+        threads.emplace_back([module]() {
+          const ZXTuneHandle player = ZXTune_CreatePlayer(module);
+          Require(player);
+          TestPlayer(player);
+          ZXTune_DestroyPlayer(player);
+        });
+      }
+      for (auto& thr : threads)
+      {
+        thr.join();
+      }
+    }
+    std::cout << "Checking stale handles" << std::endl;
+    ZXTune_DestroyPlayer(player);
+    Require(ZXTune_RenderSound(player, nullptr, 0) == -1);
+    ZXTune_CloseModule(module);
+    ZXTune_CloseData(data);
+    Require(!ZXTune_OpenModule(data));
+    std::cout << "Done" << std::endl;
   }
   catch (const std::exception&)
   {
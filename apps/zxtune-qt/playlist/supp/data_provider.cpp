@@ -37,8 +37,12 @@
 #include <strings/format.h>
 #include <strings/template.h>
 // std includes
-#include <deque>
+#include <array>
+#include <atomic>
+#include <future>
+#include <list>
 #include <mutex>
+#include <unordered_map>
 
 #define FILE_TAG 0C9BBC6E
 
@@ -99,6 +103,8 @@ namespace
     }
   };
 
+  // Least recently used objects split into independently locked shards by id hash. Limits are global, so the oldest
+  // item among all the shards is evicted first.
   template<class T, class W = typename ObjectTraits<T>::WeightType>
   class ObjectsCache
   {
@@ -107,85 +113,96 @@ namespace
       String Id;
       T Value;
       W Weight;
+      uint64_t Stamp;
+    };
+
+    typedef std::list<Item> ItemsList;
 
-      Item()
-        : Id()
-        , Value()
-        , Weight()
-      {}
-
-      Item(String id, T val)
-        : Id(std::move(id))
-        , Value(val)
-        , Weight(ObjectTraits<T>::Weight(val))
-      {}
+    // most recently used items at front
+    struct Shard
+    {
+      std::mutex Mutex;
+      ItemsList Items;
+      std::unordered_map<String, typename ItemsList::iterator> Index;
     };
 
-    typedef std::deque<Item> ItemsList;
+    static const std::size_t SHARDS = 8;
 
   public:
-    ObjectsCache()
-      : TotalWeight()
-    {}
-
     T Find(const String& id)
     {
-      if (Item* res = FindItem(id))
+      auto& shard = GetShard(id);
+      const std::lock_guard<std::mutex> lock(shard.Mutex);
+      const auto it = shard.Index.find(id);
+      if (it == shard.Index.end())
       {
-        return res->Value;
+        return T();
       }
-      return T();
+      Touch(shard, it->second);
+      return it->second->Value;
     }
 
     void Add(const String& id, T val)
     {
-      if (Item* res = FindItem(id))
+      const W weight = ObjectTraits<T>::Weight(val);
+      auto& shard = GetShard(id);
+      const std::lock_guard<std::mutex> lock(shard.Mutex);
+      const auto it = shard.Index.find(id);
+      if (it != shard.Index.end())
       {
-        const W weight = ObjectTraits<T>::Weight(val);
-        TotalWeight = TotalWeight + weight - res->Weight;
-        res->Value = val;
-        res->Weight = weight;
+        auto& item = *it->second;
+        TotalWeight += weight;
+        TotalWeight -= item.Weight;
+        item.Value = std::move(val);
+        item.Weight = weight;
+        Touch(shard, it->second);
       }
       else
       {
-        const Item item(id, val);
-        Items.push_front(item);
-        TotalWeight += item.Weight;
+        shard.Items.push_front({id, std::move(val), weight, Clock++});
+        shard.Index.emplace(id, shard.Items.begin());
+        TotalWeight += weight;
+        ++Count;
       }
     }
 
     void Del(const String& id)
     {
-      for (auto it = Items.begin(), lim = Items.end(); it != lim; ++it)
+      auto& shard = GetShard(id);
+      const std::lock_guard<std::mutex> lock(shard.Mutex);
+      const auto it = shard.Index.find(id);
+      if (it != shard.Index.end())
       {
-        if (it->Id == id)
-        {
-          TotalWeight -= ObjectTraits<T>::Weight(it->Value);
-          Items.erase(it);
-          break;
-        }
+        Erase(shard, it->second);
       }
     }
 
     void Fit(std::size_t maxCount, W maxWeight)
     {
-      while (Items.size() > maxCount || TotalWeight > maxWeight)
+      while (Count > maxCount || TotalWeight > maxWeight)
       {
-        const Item entry = Items.back();
-        Items.pop_back();
-        TotalWeight -= entry.Weight;
+        if (!EvictOldest())
+        {
+          break;
+        }
       }
     }
 
     void Clear()
     {
-      ItemsList().swap(Items);
-      TotalWeight = 0;
+      for (auto& shard : Shards)
+      {
+        const std::lock_guard<std::mutex> lock(shard.Mutex);
+        while (!shard.Items.empty())
+        {
+          Erase(shard, std::prev(shard.Items.end()));
+        }
+      }
     }
 
     std::size_t GetItemsCount() const
     {
-      return Items.size();
+      return Count;
     }
 
     W GetItemsWeight() const
@@ -194,25 +211,56 @@ namespace
     }
 
   private:
-    Item* FindItem(const String& id)
+    Shard& GetShard(const String& id)
+    {
+      return Shards[std::hash<String>()(id) % SHARDS];
+    }
+
+    // stamps are taken under shard lock, so every shard list is ordered by them
+    void Touch(Shard& shard, typename ItemsList::iterator it)
+    {
+      it->Stamp = Clock++;
+      shard.Items.splice(shard.Items.begin(), shard.Items, it);
+    }
+
+    void Erase(Shard& shard, typename ItemsList::iterator it)
+    {
+      TotalWeight -= it->Weight;
+      --Count;
+      shard.Index.erase(it->Id);
+      shard.Items.erase(it);
+    }
+
+    bool EvictOldest()
     {
-      for (auto it = Items.begin(), lim = Items.end(); it != lim; ++it)
+      Shard* oldest = nullptr;
+      uint64_t oldestStamp = 0;
+      for (auto& shard : Shards)
       {
-        if (it->Id == id)
+        const std::lock_guard<std::mutex> lock(shard.Mutex);
+        if (!shard.Items.empty() && (!oldest || shard.Items.back().Stamp < oldestStamp))
         {
-          if (it != Items.begin() && Items.size() > 1)
-          {
-            std::iter_swap(it, Items.begin());
-          }
-          return &Items.front();
+          oldest = &shard;
+          oldestStamp = shard.Items.back().Stamp;
         }
       }
-      return nullptr;
+      if (oldest)
+      {
+        const std::lock_guard<std::mutex> lock(oldest->Mutex);
+        // may be touched or removed concurrently, so just retry
+        if (!oldest->Items.empty() && oldest->Items.back().Stamp == oldestStamp)
+        {
+          Erase(*oldest, std::prev(oldest->Items.end()));
+        }
+      }
+      return oldest != nullptr;
     }
 
   private:
-    ItemsList Items;
-    W TotalWeight;
+    std::array<Shard, SHARDS> Shards;
+    std::atomic<uint64_t> Clock{0};
+    std::atomic<std::size_t> Count{0};
+    std::atomic<W> TotalWeight{0};
   };
 
   class CacheParameters
@@ -253,7 +301,6 @@ namespace
 
     Binary::Container::Ptr GetData(const String& dataPath) const override
     {
-      const std::lock_guard<std::mutex> lock(Mutex);
       const std::size_t filesLimit = Params.FilesLimit();
       const std::size_t memLimit = Params.MemoryLimit();
       if (filesLimit != 0 && memLimit != 0)
@@ -269,7 +316,6 @@ namespace
 
     void FlushCachedData(const String& dataPath)
     {
-      const std::lock_guard<std::mutex> lock(Mutex);
       if (Cache.GetItemsCount())
       {
         Cache.Del(dataPath);
@@ -278,17 +324,53 @@ namespace
     }
 
   private:
+    // data is read without locks, concurrent requests for the same path wait for the single read
     Binary::Container::Ptr GetCachedData(const String& dataPath, std::size_t filesLimit, std::size_t memLimit) const
     {
-      if (const Binary::Container::Ptr cached = Cache.Find(dataPath))
+      if (auto cached = Cache.Find(dataPath))
       {
         return cached;
       }
-      const Binary::Container::Ptr data = Delegate->GetData(dataPath);
-      Cache.Add(dataPath, data);
-      Cache.Fit(filesLimit, memLimit);
-      ReportCache();
-      return data;
+      std::promise<Binary::Container::Ptr> loaded;
+      {
+        std::unique_lock<std::mutex> lock(Mutex);
+        const auto it = Loading.find(dataPath);
+        if (it != Loading.end())
+        {
+          const auto pending = it->second;
+          lock.unlock();
+          return pending.get();
+        }
+        // may be loaded just before lock
+        if (auto cached = Cache.Find(dataPath))
+        {
+          return cached;
+        }
+        Loading.emplace(dataPath, loaded.get_future().share());
+      }
+      try
+      {
+        auto data = Delegate->GetData(dataPath);
+        Cache.Add(dataPath, data);
+        Cache.Fit(filesLimit, memLimit);
+        ReportCache();
+        loaded.set_value(data);
+        FinishLoading(dataPath);
+        return data;
+      }
+      // any failure should be delivered to waiters and should not block subsequent requests
+      catch (...)
+      {
+        loaded.set_exception(std::current_exception());
+        FinishLoading(dataPath);
+        throw;
+      }
+    }
+
+    void FinishLoading(const String& dataPath) const
+    {
+      const std::lock_guard<std::mutex> lock(Mutex);
+      Loading.erase(dataPath);
     }
 
     void ReportCache() const
@@ -300,8 +382,9 @@ namespace
   private:
     const CacheParameters Params;
     const DataProvider::Ptr Delegate;
-    mutable std::mutex Mutex;
     mutable ObjectsCache<Binary::Container::Ptr> Cache;
+    mutable std::mutex Mutex;
+    mutable std::unordered_map<String, std::shared_future<Binary::Container::Ptr>> Loading;
   };
 
   class DataSource : public Module::AdditionalFilesSource
@@ -19,13 +19,13 @@
 // library includes
 #include <async/activity.h>
 #include <debug/log.h>
-#include <math/bitops.h>
 #include <parameters/template.h>
 #include <time/serialize.h>
 #include <tools/progress_callback_helpers.h>
 // std includes
 #include <atomic>
 #include <mutex>
+#include <type_traits>
 // qt includes
 #include <QtCore/QDataStream>
 #include <QtCore/QMimeData>
@@ -139,11 +139,44 @@ namespace
       , Ascending(ascending)
     {}
 
-    bool CompareItems(const Playlist::Item::Data& lh, const Playlist::Item::Data& rh) const override
+    Playlist::Item::SortKey GetSortKey(const Playlist::Item::Data& item) const override
     {
-      const T val1 = (lh.*Getter)();
-      const T val2 = (rh.*Getter)();
-      return Ascending ? val1 < val2 : val2 < val1;
+      Playlist::Item::SortKey key;
+      SetKey((item.*Getter)(), key);
+      return key;
+    }
+
+    bool CompareKeys(const Playlist::Item::SortKey& lh, const Playlist::Item::SortKey& rh) const override
+    {
+      return Ascending ? Less(lh, rh) : Less(rh, lh);
+    }
+
+  private:
+    static void SetKey(const String& val, Playlist::Item::SortKey& key)
+    {
+      key.Text = val;
+    }
+
+    static void SetKey(Time::Milliseconds val, Playlist::Item::SortKey& key)
+    {
+      key.Number = val.Get();
+    }
+
+    static void SetKey(uint64_t val, Playlist::Item::SortKey& key)
+    {
+      key.Number = val;
+    }
+
+    static bool Less(const Playlist::Item::SortKey& lh, const Playlist::Item::SortKey& rh)
+    {
+      if constexpr (std::is_same<T, String>::value)
+      {
+        return lh.Text < rh.Text;
+      }
+      else
+      {
+        return lh.Number < rh.Number;
+      }
     }
 
   private:
@@ -186,19 +219,24 @@ namespace
     }
   }
 
-  class ComparisonsCounter : public Playlist::Item::Comparer
+  class SortKeysCounter : public Playlist::Item::Comparer
   {
   public:
-    ComparisonsCounter(const Playlist::Item::Comparer& delegate, Log::ProgressCallback& cb)
+    SortKeysCounter(const Playlist::Item::Comparer& delegate, Log::ProgressCallback& cb)
       : Delegate(delegate)
       , Callback(cb)
       , Done(0)
     {}
 
-    bool CompareItems(const Playlist::Item::Data& lh, const Playlist::Item::Data& rh) const override
+    Playlist::Item::SortKey GetSortKey(const Playlist::Item::Data& item) const override
     {
       Callback.OnProgress(++Done);
-      return Delegate.CompareItems(lh, rh);
+      return Delegate.GetSortKey(item);
+    }
+
+    bool CompareKeys(const Playlist::Item::SortKey& lh, const Playlist::Item::SortKey& rh) const override
+    {
+      return Delegate.CompareKeys(lh, rh);
     }
 
   private:
@@ -216,11 +254,9 @@ namespace
 
     void Execute(Playlist::Item::Storage& storage, Log::ProgressCallback& cb) override
     {
-      const uint_t totalItems = storage.CountItems();
-      // according to STL spec: The number of comparisons is approximately N log N, where N is the list's size. Assume
-      // that log is binary.
-      Log::PercentProgressCallback progress(totalItems * Math::Log2(totalItems), cb);
-      const ComparisonsCounter countingComparer(*Comparer, progress);
+      // attributes fetching is the most expensive part
+      Log::PercentProgressCallback progress(storage.CountItems(), cb);
+      const SortKeysCounter countingComparer(*Comparer, progress);
       storage.Sort(countingComparer);
     }
 
@@ -15,8 +15,10 @@
 // common includes
 #include <make_ptr.h>
 // library includes
+#include <module/fingerprint/api.h>
 #include <tools/progress_callback_helpers.h>
 // std includes
+#include <algorithm>
 #include <numeric>
 
 namespace
@@ -427,6 +429,100 @@ namespace
     const Playlist::Model::IndexSet::Ptr SelectedItems;
   };
 
+  // Near-duplicates detection by registers stream fingerprints
+  class SimilarItemsCollector : public Playlist::Item::Visitor
+  {
+  public:
+    SimilarItemsCollector()
+      : Index(Module::Fingerprint::Index::Create())
+    {}
+
+    void OnItem(Playlist::Model::IndexType index, Playlist::Item::Data::Ptr data) override
+    {
+      if (data->GetState())
+      {
+        return;
+      }
+      try
+      {
+        Module::Fingerprint::Signature signature;
+        const auto holder = data->GetModule();
+        if (holder && Module::Fingerprint::Calculate(*holder, signature))
+        {
+          Index->Add(index, signature);
+        }
+      }
+      catch (const Error&)
+      {}
+    }
+
+    // only clusters with at least one of filter items if specified
+    Playlist::Model::IndexSet::Ptr GetResult(const Playlist::Model::IndexSet* filter) const
+    {
+      const auto result = MakeRWPtr<Playlist::Model::IndexSet>();
+      for (const auto& cluster : Index->FindClusters(Module::Fingerprint::DEFAULT_SIMILARITY))
+      {
+        if (!filter
+            || std::any_of(cluster.begin(), cluster.end(), [filter](std::size_t idx) { return filter->count(idx); }))
+        {
+          result->insert(cluster.begin(), cluster.end());
+        }
+      }
+      return result;
+    }
+
+  private:
+    const Module::Fingerprint::Index::Ptr Index;
+  };
+
+  // Select similar
+  class SelectAllSimilarOperation : public Playlist::Item::SelectionOperation
+  {
+  public:
+    void Execute(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb) override
+    {
+      SimilarItemsCollector similar;
+      Playlist::Item::ExecuteOperation(stor, {}, similar, cb);
+      emit ResultAcquired(similar.GetResult(nullptr));
+    }
+  };
+
+  class SelectSimilarOfSelectedOperation : public Playlist::Item::SelectionOperation
+  {
+  public:
+    explicit SelectSimilarOfSelectedOperation(Playlist::Model::IndexSet::Ptr items)
+      : SelectedItems(std::move(items))
+    {}
+
+    void Execute(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb) override
+    {
+      SimilarItemsCollector similar;
+      Playlist::Item::ExecuteOperation(stor, {}, similar, cb);
+      emit ResultAcquired(similar.GetResult(SelectedItems.get()));
+    }
+
+  private:
+    const Playlist::Model::IndexSet::Ptr SelectedItems;
+  };
+
+  class SelectSimilarInSelectedOperation : public Playlist::Item::SelectionOperation
+  {
+  public:
+    explicit SelectSimilarInSelectedOperation(Playlist::Model::IndexSet::Ptr items)
+      : SelectedItems(std::move(items))
+    {}
+
+    void Execute(const Playlist::Item::Storage& stor, Log::ProgressCallback& cb) override
+    {
+      SimilarItemsCollector similar;
+      Playlist::Item::ExecuteOperation(stor, SelectedItems, similar, cb);
+      emit ResultAcquired(similar.GetResult(nullptr));
+    }
+
+  private:
+    const Playlist::Model::IndexSet::Ptr SelectedItems;
+  };
+
   // other
   class SelectTypesOfSelectedOperation : public Playlist::Item::SelectionOperation
   {
@@ -535,6 +631,21 @@ namespace Playlist
       return MakePtr<SelectRipOffsInSelectedOperation>(items);
     }
 
+    SelectionOperation::Ptr CreateSelectAllSimilarOperation()
+    {
+      return MakePtr<SelectAllSimilarOperation>();
+    }
+
+    SelectionOperation::Ptr CreateSelectSimilarOfSelectedOperation(Playlist::Model::IndexSet::Ptr items)
+    {
+      return MakePtr<SelectSimilarOfSelectedOperation>(items);
+    }
+
+    SelectionOperation::Ptr CreateSelectSimilarInSelectedOperation(Playlist::Model::IndexSet::Ptr items)
+    {
+      return MakePtr<SelectSimilarInSelectedOperation>(items);
+    }
+
     SelectionOperation::Ptr CreateSelectAllDuplicatesOperation()
     {
       return MakePtr<SelectAllDupsOperation>();
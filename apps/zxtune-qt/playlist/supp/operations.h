@@ -46,6 +46,10 @@ namespace Playlist
     SelectionOperation::Ptr CreateSelectAllRipOffsOperation();
     SelectionOperation::Ptr CreateSelectRipOffsOfSelectedOperation(Playlist::Model::IndexSet::Ptr items);
     SelectionOperation::Ptr CreateSelectRipOffsInSelectedOperation(Playlist::Model::IndexSet::Ptr items);
+    // near-duplicates by fingerprints
+    SelectionOperation::Ptr CreateSelectAllSimilarOperation();
+    SelectionOperation::Ptr CreateSelectSimilarOfSelectedOperation(Playlist::Model::IndexSet::Ptr items);
+    SelectionOperation::Ptr CreateSelectSimilarInSelectedOperation(Playlist::Model::IndexSet::Ptr items);
     // duplicates
     SelectionOperation::Ptr CreateSelectAllDuplicatesOperation();
     SelectionOperation::Ptr CreateSelectDuplicatesOfSelectedOperation(Playlist::Model::IndexSet::Ptr items);
@@ -31,6 +31,8 @@ namespace Playlist
       virtual void AddFailedToConvert(const String& path, const Error& err) = 0;
     };
 
+    // type may list several file backends delimited by Sound::BACKENDS_DELIMITER, every module is rendered once for
+    // them
     TextResultOperation::Ptr CreateSoundFormatConvertOperation(Playlist::Model::IndexSet::Ptr items, const String& type,
                                                                Sound::Service::Ptr service,
                                                                ConversionResultNotification::Ptr result);
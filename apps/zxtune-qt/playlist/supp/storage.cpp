@@ -14,7 +14,10 @@
 #include <make_ptr.h>
 // library includes
 #include <debug/log.h>
-#include <math/numeric.h>
+// std includes
+#include <algorithm>
+#include <numeric>
+#include <vector>
 // boost includes
 #include <boost/iterator/counting_iterator.hpp>
 
@@ -22,190 +25,12 @@ namespace
 {
   const Debug::Stream Dbg("Playlist::Storage");
 
-  typedef std::pair<Playlist::Item::Data::Ptr, Playlist::Model::IndexType> IndexedItem;
-
-  // simple std::list wrapper that guarantees contstant complexivity of size() method
-  class ItemsContainer : private std::list<IndexedItem>
-  {
-    typedef std::list<IndexedItem> Parent;
-
-  public:
-    using Parent::value_type;
-    using Parent::const_iterator;
-    using Parent::iterator;
-
-    using Parent::begin;
-    using Parent::end;
-    using Parent::sort;
-
-    ItemsContainer()
-      : Size()
-    {}
-
-    ItemsContainer(const ItemsContainer& rh) = default;
-
-    Parent::size_type size() const
-    {
-      return Size;
-    }
-
-    bool empty() const
-    {
-      return 0 == Size;
-    }
-
-    void push_back(const value_type& val)
-    {
-      Parent::push_back(val);
-      ++Size;
-    }
-
-    void erase(iterator it)
-    {
-      Parent::erase(it);
-      --Size;
-    }
-
-    void erase(iterator first, iterator last)
-    {
-      const std::size_t count = std::distance(first, last);
-      Parent::erase(first, last);
-      Size -= count;
-    }
-
-    void splice(iterator position, ItemsContainer& x, iterator i)
-    {
-      Parent::splice(position, x, i);
-      ++Size;
-      --x.Size;
-    }
-
-    void splice(iterator position, ItemsContainer& x, iterator first, iterator last)
-    {
-      const std::size_t count = std::distance(first, last);
-      Parent::splice(position, x, first, last);
-      Size += count;
-      x.Size -= count;
-    }
-
-    void splice(iterator position, ItemsContainer& x)
-    {
-      Parent::splice(position, x);
-      Size += x.Size;
-      x.Size = 0;
-    }
-
-    void swap(ItemsContainer& rh)
-    {
-      Parent::swap(rh);
-      std::swap(Size, rh.Size);
-    }
-
-  private:
-    std::size_t Size;
-  };
-
-  template<class IteratorType>
-  class IteratorContainerWalker
-  {
-  public:
-    virtual ~IteratorContainerWalker() = default;
-
-    virtual void OnItem(IteratorType it) = 0;
-  };
-
-  class PlaylistItemVisitorAdapter : public IteratorContainerWalker<ItemsContainer::const_iterator>
-  {
-  public:
-    explicit PlaylistItemVisitorAdapter(Playlist::Item::Visitor& delegate)
-      : Delegate(delegate)
-    {}
-
-    void OnItem(ItemsContainer::const_iterator it) override
-    {
-      Delegate.OnItem(it->second, it->first);
-    }
-
-  private:
-    Playlist::Item::Visitor& Delegate;
-  };
-
-  class RemoveItemsWalker : public IteratorContainerWalker<ItemsContainer::iterator>
-  {
-  public:
-    explicit RemoveItemsWalker(ItemsContainer& container)
-      : Container(container)
-      , LastRangeStart(Container.end())
-      , LastRangeEnd(Container.end())
-    {}
-
-    ~RemoveItemsWalker() override
-    {
-      Erase();
-    }
-
-    void OnItem(ItemsContainer::iterator it) override
-    {
-      if (it != LastRangeEnd)
-      {
-        Erase();
-        LastRangeStart = it;
-      }
-      LastRangeEnd = ++it;
-    }
-
-  private:
-    void Erase()
-    {
-      Container.erase(LastRangeStart, LastRangeEnd);
-    }
-
-  private:
-    ItemsContainer& Container;
-    ItemsContainer::iterator LastRangeStart;
-    ItemsContainer::iterator LastRangeEnd;
-  };
-
-  class MoveItemsWalker : public IteratorContainerWalker<ItemsContainer::iterator>
-  {
-  public:
-    MoveItemsWalker(ItemsContainer& src, ItemsContainer& dst)
-      : Src(src)
-      , Dst(dst)
-      , LastRangeStart(Src.end())
-      , LastRangeEnd(Src.end())
-    {}
-
-    ~MoveItemsWalker() override
-    {
-      Splice();
-    }
-
-    void OnItem(ItemsContainer::iterator it) override
-    {
-      if (it != LastRangeEnd)
-      {
-        Splice();
-        LastRangeStart = it;
-      }
-      LastRangeEnd = ++it;
-    }
-
-  private:
-    void Splice()
-    {
-      Dst.splice(Dst.end(), Src, LastRangeStart, LastRangeEnd);
-    }
-
-  private:
-    ItemsContainer& Src;
-    ItemsContainer& Dst;
-    ItemsContainer::iterator LastRangeStart;
-    ItemsContainer::iterator LastRangeEnd;
-  };
-
   using namespace Playlist;
 
+  typedef std::pair<Item::Data::Ptr, Model::IndexType> IndexedItem;
+  // contiguous storage provides constant time access by index, all the bulk modifications are linear
+  typedef std::vector<IndexedItem> ItemsContainer;
+
   class ItemsCollection : public Item::Collection
   {
   public:
@@ -234,8 +59,6 @@ namespace
     const ItemsContainer::const_iterator Limit;
   };
 
-  const std::size_t CACHE_THRESHOLD = 200;
-
   class LinearStorage : public Item::Storage
   {
   public:
@@ -279,8 +102,7 @@ namespace
 
     void Add(Item::Data::Ptr item) override
     {
-      const IndexedItem idxItem(item, static_cast<Model::IndexType>(Items.size()));
-      Items.push_back(idxItem);
+      Items.emplace_back(std::move(item), static_cast<Model::IndexType>(Items.size()));
       Modify();
     }
 
@@ -288,8 +110,7 @@ namespace
     {
       for (Model::IndexType idx = static_cast<Model::IndexType>(Items.size()); items->IsValid(); items->Next(), ++idx)
       {
-        const IndexedItem idxItem(items->Get(), idx);
-        Items.push_back(idxItem);
+        Items.emplace_back(items->Get(), idx);
       }
       Modify();
     }
@@ -305,8 +126,7 @@ namespace
       {
         return Item::Data::Ptr();
       }
-      const ItemsContainer::const_iterator it = GetIteratorByIndex(idx);
-      return it->first;
+      return Items[idx].first;
     }
 
     Item::Collection::Ptr GetItems() const override
@@ -316,16 +136,20 @@ namespace
 
     void ForAllItems(Item::Visitor& visitor) const override
     {
-      for (ItemsContainer::const_iterator it = Items.begin(), lim = Items.end(); it != lim; ++it)
+      for (const auto& item : Items)
       {
-        visitor.OnItem(it->second, it->first);
+        visitor.OnItem(item.second, item.first);
       }
     }
 
     void ForSpecifiedItems(const Model::IndexSet& indices, Playlist::Item::Visitor& visitor) const override
     {
-      PlaylistItemVisitorAdapter walker(visitor);
-      ForChoosenItems(indices, walker);
+      assert(indices.empty() || *indices.rbegin() < Items.size());
+      for (const auto idx : indices)
+      {
+        const auto& item = Items[idx];
+        visitor.OnItem(item.second, item.first);
+      }
     }
 
     void MoveItems(const Model::IndexSet& indices, Model::IndexType destination) override
@@ -349,30 +173,32 @@ namespace
       }
     }
 
+    // keys are fetched once per item, the rest of work is done with lightweight indices
     void Sort(const Item::Comparer& cmp) override
     {
-      Items.sort(ComparerWrapper(cmp));
-      ClearCache();
+      std::vector<Item::SortKey> keys;
+      keys.reserve(Items.size());
+      for (const auto& item : Items)
+      {
+        keys.emplace_back(cmp.GetSortKey(*item.first));
+      }
+      std::vector<std::size_t> order(Items.size());
+      std::iota(order.begin(), order.end(), std::size_t(0));
+      std::stable_sort(order.begin(), order.end(),
+                       [&keys, &cmp](std::size_t lh, std::size_t rh) { return cmp.CompareKeys(keys[lh], keys[rh]); });
+      ItemsContainer sorted;
+      sorted.reserve(Items.size());
+      for (const auto idx : order)
+      {
+        sorted.emplace_back(std::move(Items[idx]));
+      }
+      Items.swap(sorted);
       Modify();
     }
 
     void Shuffle() override
     {
-      std::vector<ItemsContainer::const_iterator> iters;
-      iters.reserve(Items.size());
-      for (ItemsContainer::const_iterator it = Items.begin(), lim = Items.end(); it != lim; ++it)
-      {
-        iters.push_back(it);
-      }
-      std::random_shuffle(iters.begin(), iters.end());
-      ItemsContainer newOne;
-      for (std::vector<ItemsContainer::const_iterator>::const_iterator it = iters.begin(), lim = iters.end(); it != lim;
-           ++it)
-      {
-        newOne.push_back(**it);
-      }
-      newOne.swap(Items);
-      ClearCache();
+      std::random_shuffle(Items.begin(), Items.end());
       Modify();
     }
 
@@ -382,11 +208,21 @@ namespace
       {
         return;
       }
+      assert(*indices.rbegin() < Items.size());
+      auto toRemove = indices.begin();
+      auto target = Items.begin() + *toRemove;
+      for (auto it = target, lim = Items.end(); it != lim; ++it)
       {
-        RemoveItemsWalker walker(Items);
-        ForChoosenItems(indices, walker);
+        if (toRemove != indices.end() && *toRemove == Model::IndexType(it - Items.begin()))
+        {
+          ++toRemove;
+        }
+        else
+        {
+          *target++ = std::move(*it);
+        }
       }
-      ClearCache();
+      Items.erase(target, Items.end());
       Modify();
     }
 
@@ -406,93 +242,7 @@ namespace
       return IndexedItem(item.first, idx);
     }
 
-    class ComparerWrapper : public std::binary_function<ItemsContainer::value_type, ItemsContainer::value_type, bool>
-    {
-    public:
-      explicit ComparerWrapper(const Item::Comparer& cmp)
-        : Cmp(cmp)
-      {}
-
-      result_type operator()(first_argument_type lh, second_argument_type rh) const
-      {
-        return Cmp.CompareItems(*lh.first, *rh.first);
-      }
-
-    private:
-      const Item::Comparer& Cmp;
-    };
-
-    typedef std::map<Model::IndexType, ItemsContainer::iterator> IndexToIterator;
-
-    ItemsContainer::iterator GetIteratorByIndex(Model::IndexType idx) const
-    {
-      std::pair<Model::IndexType, ItemsContainer::iterator> entry = GetNearestIterator(idx);
-      if (const std::ptrdiff_t delta = std::ptrdiff_t(idx) - entry.first)
-      {
-        std::advance(entry.second, delta);
-        if (Math::Absolute(delta) > std::ptrdiff_t(CACHE_THRESHOLD))
-        {
-          Dbg("Cached iterator for idx={}. Nearest idx={}, delta={}", idx, entry.first, delta);
-          entry.first += delta;
-          IteratorsCache.insert(entry);
-        }
-      }
-      return entry.second;
-    }
-
-    IndexToIterator::value_type GetNearestIterator(Model::IndexType idx) const
-    {
-      const IndexToIterator::value_type predefinedEntry = GetNearestPredefinedIterator(idx);
-      const std::size_t predefinedDelta = Math::Absolute<std::ptrdiff_t>(std::ptrdiff_t(idx) - predefinedEntry.first);
-      if (predefinedDelta <= CACHE_THRESHOLD || IteratorsCache.empty())
-      {
-        return predefinedEntry;
-      }
-      const IndexToIterator::value_type cachedEntry = GetNearestCachedIterator(idx);
-      const std::size_t cachedDelta = Math::Absolute<std::ptrdiff_t>(std::ptrdiff_t(idx) - cachedEntry.first);
-      if (cachedDelta <= CACHE_THRESHOLD)
-      {
-        return cachedEntry;
-      }
-      return predefinedDelta <= cachedDelta ? predefinedEntry : cachedEntry;
-    }
-
-    IndexToIterator::value_type GetNearestPredefinedIterator(Model::IndexType idx) const
-    {
-      const Model::IndexType firstIndex = 0;
-      const Model::IndexType lastIndex = Model::IndexType(Items.size() - 1);
-      const std::size_t toFirst = idx - firstIndex;
-      const std::size_t toLast = lastIndex - idx;
-      if (toFirst <= toLast)
-      {
-        return IndexToIterator::value_type(firstIndex, Items.begin());
-      }
-      else
-      {
-        return IndexToIterator::value_type(lastIndex, --Items.end());
-      }
-    }
-
-    IndexToIterator::value_type GetNearestCachedIterator(Model::IndexType idx) const
-    {
-      assert(!IteratorsCache.empty());
-      const IndexToIterator::const_iterator upper = IteratorsCache.upper_bound(idx);
-      if (upper == IteratorsCache.begin())
-      {
-        return *upper;
-      }
-      IndexToIterator::const_iterator lower = upper;
-      --lower;
-      if (upper == IteratorsCache.end())
-      {
-        return *lower;
-      }
-      // upper->first > idx
-      const std::size_t toLower = idx - lower->first;
-      const std::size_t toUpper = upper->first - idx;
-      return *(toLower <= toUpper ? lower : upper);
-    }
-
+    // [unselected before destination] + [selected] + [unselected since destination]
     void MoveItemsInternal(const Model::IndexSet& indices, Model::IndexType destination)
     {
       if (indices.empty())
@@ -500,66 +250,28 @@ namespace
         return;
       }
       assert(!indices.count(destination));
-      auto delimiter = GetIteratorByIndex(destination);
-
-      ItemsContainer movedItems;
-      {
-        MoveItemsWalker walker(Items, movedItems);
-        ForChoosenItems(indices, walker);
-      }
-      assert(indices.size() == movedItems.size());
-
-      ItemsContainer afterItems;
-      afterItems.splice(afterItems.begin(), Items, delimiter, Items.end());
-
-      // gathering back
-      Items.splice(Items.end(), movedItems);
-      Items.splice(Items.end(), afterItems);
-      ClearCache();
-      Modify();
-    }
-
-    template<class IteratorType>
-    void ForChoosenItems(const Playlist::Model::IndexSet& indices, IteratorContainerWalker<IteratorType>& walker) const
-    {
-      if (Items.empty() || indices.empty())
-      {
-        return;
-      }
       assert(*indices.rbegin() < Items.size());
-      if (indices.size() == Items.size())
+      std::vector<bool> selected(Items.size());
+      for (const auto idx : indices)
       {
-        // all items
-        for (IteratorType it = Items.begin(), lim = Items.end(); it != lim;)
-        {
-          const IteratorType op = it;
-          ++it;
-          walker.OnItem(op);
-        }
+        selected[idx] = true;
       }
-      else
-      {
-        Playlist::Model::IndexType lastIndex = *indices.begin();
-        IteratorType lastIterator = GetIteratorByIndex(lastIndex);
-        for (auto curIndex : indices)
+      ItemsContainer result;
+      result.reserve(Items.size());
+      const auto gather = [this, &selected, &result](std::size_t begin, std::size_t end, bool isSelected) {
+        for (auto idx = begin; idx != end; ++idx)
         {
-          assert(curIndex >= lastIndex);
-          if (const Playlist::Model::IndexType delta = curIndex - lastIndex)
+          if (selected[idx] == isSelected)
           {
-            std::advance(lastIterator, delta);
+            result.emplace_back(std::move(Items[idx]));
           }
-          const IteratorType op = lastIterator;
-          ++lastIterator;
-          lastIndex = curIndex + 1;
-          walker.OnItem(op);
         }
-      }
-    }
-
-    void ClearCache()
-    {
-      Dbg("Cleared iterators cache");
-      IteratorsCache.clear();
+      };
+      gather(0, destination, false);
+      gather(0, Items.size(), true);
+      gather(destination, Items.size(), false);
+      Items.swap(result);
+      Modify();
     }
 
     void Modify()
@@ -569,8 +281,7 @@ namespace
 
   private:
     unsigned Version;
-    mutable ItemsContainer Items;
-    mutable IndexToIterator IteratorsCache;
+    ItemsContainer Items;
   };
 }  // namespace
 
@@ -17,13 +17,22 @@ namespace Playlist
 {
   namespace Item
   {
+    //! Value of item attribute used for sorting, either numeric or textual
+    struct SortKey
+    {
+      uint64_t Number = 0;
+      String Text;
+    };
+
     class Comparer
     {
     public:
       typedef std::shared_ptr<const Comparer> Ptr;
       virtual ~Comparer() = default;
 
-      virtual bool CompareItems(const Data& lh, const Data& rh) const = 0;
+      //! Called once per item before sorting
+      virtual SortKey GetSortKey(const Data& item) const = 0;
+      virtual bool CompareKeys(const SortKey& lh, const SortKey& rh) const = 0;
     };
 
     class Visitor
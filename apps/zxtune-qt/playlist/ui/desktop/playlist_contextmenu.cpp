@@ -53,6 +53,7 @@ namespace
       Require(receiver.connect(DelUnavailableAction, SIGNAL(triggered()), SLOT(RemoveAllUnavailable())));
       Require(receiver.connect(ShuffleAction, SIGNAL(triggered()), SLOT(ShuffleAll())));
       Require(receiver.connect(SelRipOffsAction, SIGNAL(triggered()), SLOT(SelectAllRipOffs())));
+      Require(receiver.connect(SelSimilarAction, SIGNAL(triggered()), SLOT(SelectAllSimilar())));
       Require(receiver.connect(SelFoundAction, SIGNAL(triggered()), SLOT(SelectFound())));
       Require(receiver.connect(ShowStatisticAction, SIGNAL(triggered()), SLOT(ShowAllStatistic())));
       Require(receiver.connect(ExportAction, SIGNAL(triggered()), SLOT(ExportAll())));
@@ -75,6 +76,7 @@ namespace
       Require(receiver.connect(CropAction, SIGNAL(triggered()), SLOT(CropSelected())));
       Require(receiver.connect(DelDupsAction, SIGNAL(triggered()), SLOT(RemoveDuplicatesOfSelected())));
       Require(receiver.connect(SelRipOffsAction, SIGNAL(triggered()), SLOT(SelectRipOffsOfSelected())));
+      Require(receiver.connect(SelSimilarAction, SIGNAL(triggered()), SLOT(SelectSimilarOfSelected())));
       Require(receiver.connect(SelSameTypesAction, SIGNAL(triggered()), SLOT(SelectSameTypesOfSelected())));
       Require(receiver.connect(SelSameFilesAction, SIGNAL(triggered()), SLOT(SelectSameFilesOfSelected())));
       Require(receiver.connect(CopyToClipboardAction, SIGNAL(triggered()), SLOT(CopyPathToClipboard())));
@@ -143,6 +145,7 @@ namespace
       Require(receiver.connect(DelDupsAction, SIGNAL(triggered()), SLOT(RemoveDuplicatesInSelected())));
       Require(receiver.connect(DelUnavailableAction, SIGNAL(triggered()), SLOT(RemoveUnavailableInSelected())));
       Require(receiver.connect(SelRipOffsAction, SIGNAL(triggered()), SLOT(SelectRipOffsInSelected())));
+      Require(receiver.connect(SelSimilarAction, SIGNAL(triggered()), SLOT(SelectSimilarInSelected())));
       Require(receiver.connect(SelSameTypesAction, SIGNAL(triggered()), SLOT(SelectSameTypesOfSelected())));
       Require(receiver.connect(SelSameFilesAction, SIGNAL(triggered()), SLOT(SelectSameFilesOfSelected())));
       Require(receiver.connect(SelFoundAction, SIGNAL(triggered()), SLOT(SelectFoundInSelected())));
@@ -405,6 +408,26 @@ namespace
       ExecuteSelectOperation(op);
     }
 
+    void SelectAllSimilar() const override
+    {
+      const Playlist::Item::SelectionOperation::Ptr op = Playlist::Item::CreateSelectAllSimilarOperation();
+      ExecuteSelectOperation(op);
+    }
+
+    void SelectSimilarOfSelected() const override
+    {
+      const Playlist::Item::SelectionOperation::Ptr op =
+          Playlist::Item::CreateSelectSimilarOfSelectedOperation(SelectedItems);
+      ExecuteSelectOperation(op);
+    }
+
+    void SelectSimilarInSelected() const override
+    {
+      const Playlist::Item::SelectionOperation::Ptr op =
+          Playlist::Item::CreateSelectSimilarInSelectedOperation(SelectedItems);
+      ExecuteSelectOperation(op);
+    }
+
     void SelectSameTypesOfSelected() const override
     {
       const Playlist::Item::SelectionOperation::Ptr op =
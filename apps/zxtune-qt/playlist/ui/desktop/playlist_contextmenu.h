@@ -37,6 +37,9 @@ namespace Playlist
       virtual void SelectAllRipOffs() const = 0;
       virtual void SelectRipOffsOfSelected() const = 0;
       virtual void SelectRipOffsInSelected() const = 0;
+      virtual void SelectAllSimilar() const = 0;
+      virtual void SelectSimilarOfSelected() const = 0;
+      virtual void SelectSimilarInSelected() const = 0;
       virtual void SelectSameTypesOfSelected() const = 0;
       virtual void SelectSameFilesOfSelected() const = 0;
       virtual void CopyPathToClipboard() const = 0;
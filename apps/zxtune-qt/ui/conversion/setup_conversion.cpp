@@ -29,6 +29,12 @@
 #include <io/providers_parameters.h>
 #include <parameters/merged_accessor.h>
 #include <sound/backends_parameters.h>
+#include <sound/service.h>
+// std includes
+#include <algorithm>
+// boost includes
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
 // qt includes
 #include <QtCore/QThread>
 #include <QtGui/QCloseEvent>
@@ -135,7 +141,7 @@ namespace
       toolBox->setItemText(TEMPLATE_PAGE, templ);
       if (QPushButton* okButton = buttonBox->button(QDialogButtonBox::Ok))
       {
-        okButton->setEnabled(!templ.isEmpty());
+        okButton->setEnabled(!templ.isEmpty() && !TargetFormat->GetSelectedId().empty());
       }
     }
 
@@ -146,16 +152,22 @@ namespace
 
     void UpdateSettingsDescription()
     {
+      Strings::Array types;
       const String type = TargetFormat->GetSelectedId();
+      boost::algorithm::split(types, type, boost::algorithm::is_any_of(String(1, Sound::BACKENDS_DELIMITER)));
+      QStringList descriptions;
       for (auto& wid : BackendSettings)
       {
-        wid.second->setVisible(false);
+        const bool selected = std::find(types.begin(), types.end(), wid.first) != types.end();
+        wid.second->setVisible(selected);
+        if (selected)
+        {
+          descriptions << wid.second->GetDescription();
+        }
       }
-      const auto it = BackendSettings.find(type);
-      if (it != BackendSettings.end())
+      if (!descriptions.isEmpty())
       {
-        it->second->setVisible(true);
-        toolBox->setItemText(SETTINGS_PAGE, it->second->GetDescription());
+        toolBox->setItemText(SETTINGS_PAGE, descriptions.join(QLatin1String("; ")));
         toolBox->setItemEnabled(SETTINGS_PAGE, true);
       }
       else
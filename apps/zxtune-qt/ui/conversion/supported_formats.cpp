@@ -22,7 +22,7 @@
 // std includes
 #include <set>
 // qt includes
-#include <QtWidgets/QRadioButton>
+#include <QtWidgets/QCheckBox>
 
 namespace
 {
@@ -91,41 +91,50 @@ namespace
       // fixup
       for (const auto& id2b : Buttons)
       {
-        if (id2b.second->isChecked())
+        if (id2b.second->isChecked() && !id2b.second->isEnabled())
         {
-          selectWAV->setChecked(!id2b.second->isEnabled());
-          return;
+          id2b.second->setChecked(false);
         }
       }
-      selectWAV->setChecked(true);
+      if (GetSelectedId().empty())
+      {
+        selectWAV->setChecked(true);
+      }
     }
 
+    // Several formats are rendered at once
     String GetSelectedId() const override
     {
+      String result;
       for (const auto& id2b : Buttons)
       {
         if (id2b.second->isChecked())
         {
-          return id2b.first;
+          if (!result.empty())
+          {
+            result += Sound::BACKENDS_DELIMITER;
+          }
+          result += id2b.first;
         }
       }
-      return {};
+      return result;
     }
 
     QString GetDescription() const override
     {
+      QStringList result;
       for (const auto& id2b : Buttons)
       {
         if (id2b.second->isChecked())
         {
-          return id2b.second->text();
+          result << id2b.second->text();
         }
       }
-      return {};
+      return result.join(QLatin1String(", "));
     }
 
   private:
-    typedef std::map<String, QRadioButton*> IdToButton;
+    typedef std::map<String, QCheckBox*> IdToButton;
 
     void SetupButton(IdToButton::value_type but)
     {
@@ -139,7 +148,8 @@ namespace
       {
         but.second->setEnabled(true);
       }
-      Parameters::ExclusiveValue::Bind(*but.second, *Options, Parameters::ZXTuneQT::UI::Export::TYPE, but.first);
+      Parameters::ListItemValue::Bind(*but.second, *Options, Parameters::ZXTuneQT::UI::Export::TYPE, but.first,
+                                      Sound::BACKENDS_DELIMITER);
     }
 
   private:
@@ -72,6 +72,7 @@ namespace
 
       using namespace Parameters::ZXTune::Sound::Backends::Alsa;
       Parameters::IntegerValue::Bind(*latency, *Options, LATENCY, LATENCY_DEFAULT);
+      Parameters::BooleanValue::Bind(*mmap, *Options, MMAP, MMAP_DEFAULT);
       Require(connect(mixers, SIGNAL(currentIndexChanged(const QString&)), SLOT(MixerChanged(const QString&))));
       Require(connect(devices, SIGNAL(currentIndexChanged(const QString&)), SLOT(DeviceChanged(const QString&))));
     }
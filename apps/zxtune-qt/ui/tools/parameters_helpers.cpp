@@ -15,6 +15,9 @@
 // library includes
 #include <debug/log.h>
 #include <math/numeric.h>
+// std includes
+#include <algorithm>
+#include <vector>
 // qt includes
 #include <QtWidgets/QAbstractButton>
 #include <QtWidgets/QAction>
@@ -131,6 +134,89 @@ namespace
     const StringType Value;
   };
 
+  class StringListItemValue : public ListItemValue
+  {
+  public:
+    StringListItemValue(QAbstractButton& parent, Container& ctr, Identifier name, StringView value, Char delimiter)
+      : ListItemValue(parent)
+      , Parent(parent)
+      , Storage(ctr)
+      , Name(name)
+      , Value(value.to_string())
+      , Delimiter(delimiter)
+    {
+      StringListItemValue::Reload();
+      Require(connect(&parent, SIGNAL(toggled(bool)), SLOT(Set(bool))));
+    }
+
+    void Set(bool value) override
+    {
+      auto items = GetItems();
+      const auto it = std::find(items.begin(), items.end(), Value);
+      if (value == (it != items.end()))
+      {
+        return;
+      }
+      else if (value)
+      {
+        items.push_back(Value);
+      }
+      else
+      {
+        items.erase(it);
+      }
+      StringType result;
+      for (const auto& item : items)
+      {
+        if (!result.empty())
+        {
+          result += Delimiter;
+        }
+        result += item;
+      }
+      Dbg("{}={}", static_cast<StringView>(Name), result);
+      Storage.SetValue(Name, result);
+    }
+
+    void Reset() override
+    {
+      const AutoBlockSignal block(Parent);
+      Storage.RemoveValue(Name);
+      Reload();
+    }
+
+    void Reload() override
+    {
+      const auto items = GetItems();
+      Parent.setChecked(std::find(items.begin(), items.end(), Value) != items.end());
+    }
+
+  private:
+    std::vector<StringType> GetItems() const
+    {
+      StringType value;
+      Storage.FindValue(Name, value);
+      std::vector<StringType> result;
+      for (StringType::size_type start = 0; start < value.size();)
+      {
+        const auto end = std::min(value.find(Delimiter, start), value.size());
+        if (end != start)
+        {
+          result.push_back(value.substr(start, end - start));
+        }
+        start = end + 1;
+      }
+      return result;
+    }
+
+  private:
+    QAbstractButton& Parent;
+    Container& Storage;
+    const Identifier Name;
+    const StringType Value;
+    const Char Delimiter;
+  };
+
   template<class Holder>
   void SetWidgetValue(Holder& holder, int val)
   {
@@ -357,6 +443,10 @@ namespace Parameters
     : Value(parent)
   {}
 
+  ListItemValue::ListItemValue(QObject& parent)
+    : Value(parent)
+  {}
+
   IntegerValue::IntegerValue(QObject& parent)
     : Value(parent)
   {}
@@ -389,6 +479,11 @@ namespace Parameters
     return new StringSetValue(button, ctr, name, value);
   }
 
+  Value* ListItemValue::Bind(QAbstractButton& button, Container& ctr, Identifier name, StringView value, Char delimiter)
+  {
+    return new StringListItemValue(button, ctr, name, value, delimiter);
+  }
+
   Value* IntegerValue::Bind(QComboBox& combo, Container& ctr, Identifier name, int defValue)
   {
     return new IntegerValueImpl<QComboBox>(combo, ctr, name, defValue);
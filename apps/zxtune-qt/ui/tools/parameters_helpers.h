@@ -95,6 +95,19 @@ namespace Parameters
     virtual void Reset() = 0;
   };
 
+  //! Button is checked if value is one of the delimited list items
+  class ListItemValue : public Value
+  {
+    Q_OBJECT
+  protected:
+    explicit ListItemValue(QObject& parent);
+
+  public:
+    static Value* Bind(QAbstractButton& button, Container& ctr, Identifier name, StringView value, Char delimiter);
+  private slots:
+    virtual void Set(bool value) = 0;
+  };
+
   class IntegerValue : public Value
   {
     Q_OBJECT
@@ -31,6 +31,7 @@
 #include <module/attributes.h>
 #include <module/conversion/api.h>
 #include <module/conversion/types.h>
+#include <module/fingerprint/api.h>
 #include <parameters/merged_accessor.h>
 #include <parameters/template.h>
 #include <platform/application.h>
@@ -367,7 +368,46 @@ namespace
     DisplayComponent& Display;
   };
 
+  class SimilarityFinder : public OnItemCallback
+  {
+  public:
+    SimilarityFinder(uint_t similarity, DisplayComponent& display)
+      : Similarity(similarity)
+      , Display(display)
+      , Index(Module::Fingerprint::Index::Create())
+    {}
+
+    void ProcessItem(Binary::Data::Ptr /*data*/, Module::Holder::Ptr holder) override
+    {
+      Module::Fingerprint::Signature signature;
+      if (Module::Fingerprint::Calculate(*holder, signature))
+      {
+        Index->Add(Paths.size(), signature);
+        Paths.push_back(GetModuleId(*holder->GetModuleProperties()));
+      }
+    }
+
+    void Report() const
+    {
+      const auto clusters = Index->FindClusters(Similarity);
+      for (std::size_t cluster = 0; cluster != clusters.size(); ++cluster)
+      {
+        for (const auto idx : clusters[cluster])
+        {
+          Display.Message("Similar #{0}\t{1}", cluster + 1, Paths[idx]);
+        }
+      }
+    }
+
+  private:
+    const uint_t Similarity;
+    DisplayComponent& Display;
+    const Module::Fingerprint::Index::Ptr Index;
+    Strings::Array Paths;
+  };
+
   const auto NO_BENCHMARK = ~0u;
+  const auto NO_SIMILARITY = ~0u;
 
   class CLIApplication
     : public Platform::Application
@@ -382,6 +422,7 @@ namespace
       , Display(DisplayComponent::Create())
       , SeekStep(10)
       , BenchmarkIterations(NO_BENCHMARK)
+      , Similarity(NO_SIMILARITY)
     {}
 
     int Run(Strings::Array args) override
@@ -408,6 +449,12 @@ namespace
           Benchmark benchmark(BenchmarkIterations, DumpUnknownData, *Sounder, *Display);
           Sourcer->ProcessItems(benchmark);
         }
+        else if (NO_SIMILARITY != Similarity)
+        {
+          SimilarityFinder finder(Similarity, *Display);
+          Sourcer->ProcessItems(finder);
+          finder.Report();
+        }
         else
         {
           Sounder->Initialize();
@@ -448,6 +495,9 @@ namespace
               ".");
           opt("benchmark", value<uint_t>(&BenchmarkIterations),
               "Switch on benchmark mode with specified iterations count.\n");
+          opt("find-similar", value<uint_t>(&Similarity),
+              "Report groups of similar modules instead of playback.\n"
+              "Parameter is minimal similarity in percents.\n");
           opt("dump-unknown-data", bool_switch(&DumpUnknownData), "Also report about unprocessed data regions.\n");
         }
         options.add(Informer->GetOptionsDescription());
@@ -594,6 +644,7 @@ namespace
     std::unique_ptr<DisplayComponent> Display;
     uint_t SeekStep;
     uint_t BenchmarkIterations;
+    uint_t Similarity;
     bool DumpUnknownData = false;
   };
 }  // namespace
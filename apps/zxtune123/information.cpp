@@ -362,6 +362,8 @@ namespace
          "mixer for ALSA backend (taking the first one if not specified)", EMPTY},
         {Parameters::ZXTune::Sound::Backends::Alsa::LATENCY, "latency in ms for ALSA backend",
          Parameters::ZXTune::Sound::Backends::Alsa::LATENCY_DEFAULT},
+        {Parameters::ZXTune::Sound::Backends::Alsa::MMAP, "use memory-mapped output for ALSA backend",
+         Parameters::ZXTune::Sound::Backends::Alsa::MMAP_DEFAULT},
         {Parameters::ZXTune::Sound::Backends::Sdl::BUFFERS, "buffers count for SDL backend",
          Parameters::ZXTune::Sound::Backends::Sdl::BUFFERS_DEFAULT},
         {Parameters::ZXTune::Sound::Backends::DirectSound::LATENCY, "latency in ms for DirectSound backend",
@@ -423,6 +425,12 @@ namespace
          Parameters::ZXTune::Core::SAA::CLOCKRATE_DEFAULT},
         {Parameters::ZXTune::Core::SAA::INTERPOLATION, "use interpolation for SAA rendering",
          Parameters::ZXTune::Core::SAA::INTERPOLATION_DEFAULT},
+        {Parameters::ZXTune::Core::LOCATIONS_CACHE_SIZE_MB,
+         "memory limit in megabytes for resolved nested locations cache, 0 to disable",
+         Parameters::ZXTune::Core::LOCATIONS_CACHE_SIZE_MB_DEFAULT},
+        {Parameters::ZXTune::Core::DECODE_THREADS,
+         "threads to decode FLAC and MP3 in parallel, 0 for sequential. Defaults to CPU cores for file backends",
+         Parameters::ZXTune::Core::DECODE_THREADS_DEFAULT},
         // Core plugins options
         {" Core plugins options:"},
         {Parameters::ZXTune::Core::Plugins::Raw::PLAIN_DOUBLE_ANALYSIS, "analyze cap_plain plugins twice", EMPTY},
@@ -431,7 +439,19 @@ namespace
         {Parameters::ZXTune::Core::Plugins::Hrip::IGNORE_CORRUPTED, "ignore corrupted blocks in HRiP archive", EMPTY},
         {Parameters::ZXTune::Core::Plugins::Zip::MAX_DEPACKED_FILE_SIZE_MB,
          "maximal file size to be depacked from .zip archive",
-         Parameters::ZXTune::Core::Plugins::Zip::MAX_DEPACKED_FILE_SIZE_MB_DEFAULT}};
+         Parameters::ZXTune::Core::Plugins::Zip::MAX_DEPACKED_FILE_SIZE_MB_DEFAULT},
+        {Parameters::ZXTune::Core::Plugins::Archives::PREFETCH_FILES,
+         "files count to be depacked from archives ahead of detection in a separate thread, 0 to disable",
+         Parameters::ZXTune::Core::Plugins::Archives::PREFETCH_FILES_DEFAULT},
+        {Parameters::ZXTune::Core::Plugins::Archives::PREFETCH_SIZE_MB,
+         "maximal total size of files depacked from archives ahead of detection",
+         Parameters::ZXTune::Core::Plugins::Archives::PREFETCH_SIZE_MB_DEFAULT},
+        {Parameters::ZXTune::Core::Plugins::Multi::THREADS,
+         "additional threads count to render multidevice modules streams concurrently",
+         Parameters::ZXTune::Core::Plugins::Multi::THREADS_DEFAULT},
+        {Parameters::ZXTune::Core::Plugins::Multi::PARALLEL_MIN_SAMPLES,
+         "minimal frame size in samples to render multidevice modules streams concurrently",
+         Parameters::ZXTune::Core::Plugins::Multi::PARALLEL_MIN_SAMPLES_DEFAULT}};
     StdOut << "Supported zxtune options:" << std::endl;
     for (const auto& opt : OPTIONS)
     {
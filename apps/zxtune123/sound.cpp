@@ -20,6 +20,7 @@
 #include <parameters/merged_accessor.h>
 #include <parameters/serialize.h>
 #include <platform/application.h>
+#include <sound/backend_attrs.h>
 #include <sound/backends_parameters.h>
 #include <sound/render_params.h>
 #include <sound/service.h>
@@ -156,6 +157,15 @@ namespace
       }
       Params->SetSoundParameters(SoundOptions);
       Params->SetLooped(Looped);
+      if (BackendOptions.size() > 1 && AreFileBackends())
+      {
+        // render once for all the specified files
+        for (const auto& backend : BackendOptions)
+        {
+          UsedId += UsedId.empty() ? backend.first : Sound::BACKENDS_DELIMITER + backend.first;
+        }
+        Dbg("Using combined backend {}", UsedId);
+      }
     }
 
     void Initialize() override {}
@@ -200,6 +210,21 @@ namespace
       throw Error(THIS_LINE, "Failed to create any backend.");
     }
 
+    bool AreFileBackends() const
+    {
+      for (Sound::BackendInformation::Iterator::Ptr backends = Service->EnumerateBackends(); backends->IsValid();
+           backends->Next())
+      {
+        const Sound::BackendInformation::Ptr info = backends->Get();
+        if (BackendOptions.count(info->Id())
+            && Sound::CAP_TYPE_FILE != (info->Capabilities() & Sound::CAP_TYPE_MASK))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
     Sound::BackendInformation::Iterator::Ptr EnumerateBackends() const override
     {
       return Service->EnumerateBackends();
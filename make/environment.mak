@@ -16,7 +16,7 @@ android.cxx.flags = -no-canonical-prefixes -funwind-tables -fstack-protector-str
 android.ld.flags = -no-canonical-prefixes -Wl,-soname,$(notdir $@) -Wl,--no-undefined -Wl,-z,noexecstack -Wl,-z,relro -Wl,-z,now -static-libstdc++ -fuse-ld=lld -flto
 #assume that all the platforms are little-endian
 #this required to use boost which doesn't know anything about __armel__ or __mipsel__
-defines.android += ANDROID __ANDROID__ __LITTLE_ENDIAN__ NO_DEBUG_LOGS NO_L10N LITTLE_ENDIAN
+defines.android += ANDROID __ANDROID__ __LITTLE_ENDIAN__ NO_DEBUG_LOGS NO_DEBUG_TRACES NO_L10N LITTLE_ENDIAN
 # x86
 android.x86.execprefix = $(android.toolchain)/i686-linux-android-
 android.x86.cxx.flags = -m32 -target i686-linux-android16
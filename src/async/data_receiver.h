@@ -57,6 +57,8 @@ namespace Async
       Delegate->Flush();
     }
 
+    //! @param workersCount threads count to process data in, used as is. Consider limiting it by
+    //!        std::thread::hardware_concurrency() for CPU-bound stages to avoid cores oversubscription
     static typename ::DataReceiver<T>::Ptr Create(std::size_t workersCount, std::size_t queueSize,
                                                   typename ::DataReceiver<T>::Ptr delegate)
     {
@@ -0,0 +1,21 @@
+/**
+ *
+ * @file
+ *
+ * @brief Process-wide threads pool interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// std includes
+#include <functional>
+
+namespace Async
+{
+  //! @brief Executes task on cached worker thread, shared with activities
+  //! @note Task should not throw
+  void ExecuteInPool(std::function<void()> task);
+}  // namespace Async
@@ -15,12 +15,84 @@
 #include <pointers.h>
 // library includes
 #include <async/activity.h>
+#include <async/pool.h>
 // std includes
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <deque>
+#include <functional>
 #include <thread>
 
 namespace Async
 {
+  // Process-wide cache of worker threads, so activities do not pay for threads creation and joining.
+  // Operations are long-running and blocking (playback loops, consumers of chained pipeline stages), so the amount of
+  // busy threads is not limited to avoid deadlocks; only idle threads are kept for a while to be reused.
+  class ThreadsPool
+  {
+  public:
+    using Task = std::function<void()>;
+
+    static ThreadsPool& Instance()
+    {
+      // never destroyed to keep idle detached workers valid at exit
+      static auto* self = new ThreadsPool();
+      return *self;
+    }
+
+    void Execute(Task task)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Mutex);
+        if (Idle > Tasks.size())
+        {
+          Tasks.push_back(std::move(task));
+          Condition.notify_one();
+          return;
+        }
+      }
+      std::thread(&ThreadsPool::WorkProc, this, std::move(task)).detach();
+    }
+
+  private:
+    ThreadsPool()
+      : MaxIdle(std::max<std::size_t>(std::thread::hardware_concurrency(), 4))
+    {}
+
+    void WorkProc(Task task)
+    {
+      static const std::chrono::seconds IDLE_TIMEOUT(30);
+      for (;;)
+      {
+        task();
+        // release captured objects before waiting
+        task = Task();
+        std::unique_lock<std::mutex> lock(Mutex);
+        if (Idle >= MaxIdle)
+        {
+          return;
+        }
+        ++Idle;
+        const bool hasTask = Condition.wait_for(lock, IDLE_TIMEOUT, [this]() { return !Tasks.empty(); });
+        --Idle;
+        if (!hasTask)
+        {
+          return;
+        }
+        task = std::move(Tasks.front());
+        Tasks.pop_front();
+      }
+    }
+
+  private:
+    const std::size_t MaxIdle;
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    std::deque<Task> Tasks;
+    std::size_t Idle = 0;
+  };
+
   enum class ActivityState
   {
     STOPPED,
@@ -37,6 +109,7 @@ namespace Async
     explicit ThreadActivity(Operation::Ptr op)
       : Oper(std::move(op))
       , State(ActivityState::STOPPED)
+      , Finished(std::make_shared<Event<bool>>())
     {}
 
     ~ThreadActivity() override
@@ -46,10 +119,15 @@ namespace Async
 
     void Start()
     {
-      Thread = std::thread(&ThreadActivity::WorkProc, this);
+      // like a joined thread, task does not own activity and signals about its finish at the very end,
+      // so activity and operation are released by the owner
+      ThreadsPool::Instance().Execute([this, finished = Finished]() {
+        WorkProc();
+        finished->Set(true);
+      });
       if (ActivityState::FAILED == State.WaitForAny(ActivityState::INITIALIZED, ActivityState::FAILED))
       {
-        Thread.join();
+        Finished->Wait(true);
         State.Set(ActivityState::STOPPED);
         throw LastError;
       }
@@ -63,10 +141,7 @@ namespace Async
 
     void Wait() override
     {
-      if (Thread.joinable())
-      {
-        Thread.join();
-      }
+      Finished->Wait(true);
       ThrowIfError(LastError);
     }
 
@@ -92,7 +167,8 @@ namespace Async
   private:
     const Operation::Ptr Oper;
     Event<ActivityState> State;
-    std::thread Thread;
+    // outlives activity to be safely signalled
+    const std::shared_ptr<Event<bool>> Finished;
     Error LastError;
   };
 
@@ -122,4 +198,9 @@ namespace Async
     static StubActivity stub;
     return MakeSingletonPointer(stub);
   }
+
+  void ExecuteInPool(std::function<void()> task)
+  {
+    ThreadsPool::Instance().Execute(std::move(task));
+  }
 }  // namespace Async
@@ -67,6 +67,26 @@ namespace
     }
   };
 
+  class ReleaseTrackingOperation : public Operation
+  {
+  public:
+    explicit ReleaseTrackingOperation(std::thread::id& releasedBy)
+      : ReleasedBy(releasedBy)
+    {}
+
+    ~ReleaseTrackingOperation() override
+    {
+      ReleasedBy = std::this_thread::get_id();
+    }
+
+    void Prepare() override {}
+
+    void Execute() override {}
+
+  private:
+    std::thread::id& ReleasedBy;
+  };
+
   void TestInvalidActivity()
   {
     std::cout << "Test for invalid activity" << std::endl;
@@ -138,6 +158,24 @@ namespace
     result->Wait();
     std::cout << "Succeed\n";
   }
+
+  void TestOperationRelease()
+  {
+    std::cout << "Test for operation release after wait" << std::endl;
+    for (uint_t idx = 0; idx != 1000; ++idx)
+    {
+      std::thread::id releasedBy;
+      {
+        const Activity::Ptr result = Activity::Create(MakePtr<ReleaseTrackingOperation>(releasedBy));
+        result->Wait();
+      }
+      if (releasedBy != std::this_thread::get_id())
+      {
+        throw Error(THIS_LINE, "Operation should be released by activity owner");
+      }
+    }
+    std::cout << "Succeed\n";
+  }
 }  // namespace
 
 int main()
@@ -147,6 +185,7 @@ int main()
     TestInvalidActivity();
     TestActivityErrorResult();
     TestLongActivity();
+    TestOperationRelease();
   }
   catch (const Error& err)
   {
@@ -0,0 +1,168 @@
+/**
+ *
+ * @file
+ *
+ * @brief Asynchronous activities benchmark
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include <async/activity.h>
+#include <async/data_receiver.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <make_ptr.h>
+#include <thread>
+#include <vector>
+
+#define FILE_TAG 5A1E2C84
+
+namespace
+{
+  using namespace Async;
+
+  const std::size_t ITERATIONS = 2000;
+  const std::size_t BATCH = 8;
+  const std::size_t STAGES = 3;
+  const std::size_t ITEMS = 100000;
+
+  class CountOperation : public Operation
+  {
+  public:
+    explicit CountOperation(std::atomic<std::size_t>& counter)
+      : Counter(counter)
+    {}
+
+    void Prepare() override {}
+
+    void Execute() override
+    {
+      ++Counter;
+    }
+
+  private:
+    std::atomic<std::size_t>& Counter;
+  };
+
+  class CountReceiver : public ::DataReceiver<std::size_t>
+  {
+  public:
+    explicit CountReceiver(std::atomic<std::size_t>& counter)
+      : Counter(counter)
+    {}
+
+    void ApplyData(std::size_t data) override
+    {
+      Counter += data;
+    }
+
+    void Flush() override {}
+
+  private:
+    std::atomic<std::size_t>& Counter;
+  };
+
+  template<class Func>
+  void Measure(const char* name, Func func)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "  " << name << ": " << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << "us"
+              << std::endl;
+  }
+
+  void Check(std::size_t value, std::size_t reference)
+  {
+    if (value != reference)
+    {
+      throw Error(THIS_LINE, "Invalid result");
+    }
+  }
+
+  // the same activities lifecycle as it was before pooling
+  void ExecuteDedicatedThreads(std::atomic<std::size_t>& counter)
+  {
+    for (std::size_t iter = 0; iter != ITERATIONS; ++iter)
+    {
+      std::vector<std::thread> threads;
+      for (std::size_t idx = 0; idx != BATCH; ++idx)
+      {
+        threads.emplace_back([&counter]() { CountOperation(counter).Execute(); });
+      }
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+    }
+  }
+
+  void ExecuteActivities(std::atomic<std::size_t>& counter)
+  {
+    const auto op = MakePtr<CountOperation>(counter);
+    for (std::size_t iter = 0; iter != ITERATIONS; ++iter)
+    {
+      std::vector<Activity::Ptr> activities;
+      for (std::size_t idx = 0; idx != BATCH; ++idx)
+      {
+        activities.push_back(Activity::Create(op));
+      }
+      for (const auto& act : activities)
+      {
+        act->Wait();
+      }
+    }
+  }
+
+  void TestActivities()
+  {
+    std::cout << "Test for " << ITERATIONS << " batches of " << BATCH << " short activities" << std::endl;
+    std::atomic<std::size_t> counter(0);
+    Measure("dedicated threads", [&counter]() { ExecuteDedicatedThreads(counter); });
+    Check(counter, ITERATIONS * BATCH);
+    counter = 0;
+    Measure("pooled activities", [&counter]() { ExecuteActivities(counter); });
+    Check(counter, ITERATIONS * BATCH);
+    std::cout << "Succeed\n";
+  }
+
+  void TestPipeline()
+  {
+    std::cout << "Test for " << STAGES << " chained stages pipeline" << std::endl;
+    std::atomic<std::size_t> counter(0);
+    Measure("pipeline", [&counter]() {
+      for (std::size_t iter = 0; iter != 100; ++iter)
+      {
+        ::DataReceiver<std::size_t>::Ptr target = MakePtr<CountReceiver>(counter);
+        for (std::size_t stage = 0; stage != STAGES; ++stage)
+        {
+          target = Async::DataReceiver<std::size_t>::Create(std::thread::hardware_concurrency(), 100, target);
+        }
+        for (std::size_t item = 0; item != ITEMS / 100; ++item)
+        {
+          target->ApplyData(1);
+        }
+        target->Flush();
+      }
+    });
+    Check(counter, ITEMS);
+    std::cout << "Succeed\n";
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    TestActivities();
+    TestPipeline();
+  }
+  catch (const Error& err)
+  {
+    std::cout << "Failed: \n";
+    std::cerr << err.ToString();
+    return 1;
+  }
+}
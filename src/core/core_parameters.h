@@ -24,6 +24,25 @@ namespace Parameters
       //! @brief Parameters#ZXTune#Core namespace prefix
       const auto PREFIX = ZXTune::PREFIX + "core"_id;
 
+      //@{
+      //! @name Memory limit in megabytes for resolved nested locations cache. Zero disables caching
+
+      //! Default value
+      const IntType LOCATIONS_CACHE_SIZE_MB_DEFAULT = 32;
+      //! Parameter name
+      const auto LOCATIONS_CACHE_SIZE_MB = PREFIX + "locations_cache_size_mb"_id;
+      //@}
+
+      //@{
+      //! @name Threads count to decode streamed formats (FLAC, MP3) by segments in parallel. Less than 2 means
+      //! sequential decoding. Set for offline rendering by file backends
+
+      //! Default value
+      const IntType DECODE_THREADS_DEFAULT = 0;
+      //! Parameter name
+      const auto DECODE_THREADS = PREFIX + "decode_threads"_id;
+      //@}
+
       //! @brief AYM-chip related parameters namespace
       namespace AYM
       {
@@ -16,13 +16,22 @@
 #include <progress_callback.h>
 // library includes
 #include <core/plugin_attrs.h>
+#include <core/plugins_parameters.h>
 #include <debug/log.h>
+#include <debug/trace.h>
 #include <module/attributes.h>
 #include <strings/format.h>
+// std includes
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 namespace ZXTune
 {
   const Debug::Stream ArchivedDbg("Core::ArchivesSupp");
+  const Debug::Trace::Scope ArchivedDecodeScope("Core::Archived::Decode");
 
   class LoggerHelper
   {
@@ -97,6 +106,151 @@ namespace ZXTune
     ArchiveCallback& Callback;
   };
 
+  // Depacks archive files in a single separate thread ahead of their processing, so depacking of next files overlaps
+  // with detection in the current one but files are never depacked concurrently: archive decoders are not required to
+  // be thread-safe (e.g. solid RAR chains).
+  // Files are passed to target in walking order, queue is limited by files count and total data size.
+  class PrefetchingWalker : private Formats::Archived::Container::Walker
+  {
+  public:
+    PrefetchingWalker(std::size_t maxFiles, std::size_t maxSize)
+      : MaxFiles(maxFiles)
+      , MaxSize(maxSize)
+    {}
+
+    void Explore(const Formats::Archived::Container& archive, const Formats::Archived::Container::Walker& target)
+    {
+      std::thread worker([this, &archive]() { Depack(archive); });
+      try
+      {
+        while (const auto file = Get())
+        {
+          target.OnFile(*file);
+        }
+      }
+      catch (...)
+      {
+        Stop();
+        worker.join();
+        throw;
+      }
+      worker.join();
+      if (Error)
+      {
+        std::rethrow_exception(Error);
+      }
+    }
+
+  private:
+    class PrefetchedFile : public Formats::Archived::File
+    {
+    public:
+      PrefetchedFile(String name, std::size_t size, Binary::Container::Ptr data)
+        : Name(std::move(name))
+        , Size(size)
+        , Data(std::move(data))
+      {}
+
+      String GetName() const override
+      {
+        return Name;
+      }
+
+      std::size_t GetSize() const override
+      {
+        return Size;
+      }
+
+      Binary::Container::Ptr GetData() const override
+      {
+        return Data;
+      }
+
+      std::size_t GetDataSize() const
+      {
+        return Data ? Data->Size() : 0;
+      }
+
+    private:
+      const String Name;
+      const std::size_t Size;
+      const Binary::Container::Ptr Data;
+    };
+
+    struct Stopped
+    {};
+
+    // worker thread
+    void Depack(const Formats::Archived::Container& archive)
+    {
+      try
+      {
+        archive.ExploreFiles(*this);
+      }
+      catch (const Stopped&)
+      {}
+      catch (...)
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        Error = std::current_exception();
+      }
+      const std::lock_guard<std::mutex> lock(Guard);
+      Finished = true;
+      CanGet.notify_one();
+    }
+
+    void OnFile(const Formats::Archived::File& file) const override
+    {
+      auto prefetched = std::make_unique<PrefetchedFile>(file.GetName(), file.GetSize(), file.GetData());
+      const auto size = prefetched->GetDataSize();
+      std::unique_lock<std::mutex> lock(Guard);
+      CanPut.wait(lock, [this, size]() {
+        return IsStopped || Queue.empty() || (Queue.size() < MaxFiles && QueuedSize + size <= MaxSize);
+      });
+      if (IsStopped)
+      {
+        throw Stopped();
+      }
+      QueuedSize += size;
+      Queue.push_back(std::move(prefetched));
+      CanGet.notify_one();
+    }
+
+    std::unique_ptr<PrefetchedFile> Get()
+    {
+      std::unique_lock<std::mutex> lock(Guard);
+      CanGet.wait(lock, [this]() { return Finished || !Queue.empty(); });
+      if (Queue.empty())
+      {
+        return {};
+      }
+      auto result = std::move(Queue.front());
+      Queue.pop_front();
+      QueuedSize -= result->GetDataSize();
+      CanPut.notify_one();
+      return result;
+    }
+
+    void Stop()
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      IsStopped = true;
+      CanPut.notify_one();
+    }
+
+  private:
+    const std::size_t MaxFiles;
+    const std::size_t MaxSize;
+    mutable std::mutex Guard;
+    mutable std::condition_variable CanPut;
+    mutable std::condition_variable CanGet;
+    mutable std::deque<std::unique_ptr<PrefetchedFile>> Queue;
+    mutable std::size_t QueuedSize = 0;
+    bool IsStopped = false;
+    bool Finished = false;
+    std::exception_ptr Error;
+  };
+
   class ArchivedContainerPlugin : public ArchivePlugin
   {
   public:
@@ -126,16 +280,24 @@ namespace ZXTune
       return Decoder->GetFormat();
     }
 
-    Analysis::Result::Ptr Detect(const Parameters::Accessor& /*params*/, DataLocation::Ptr input,
+    Analysis::Result::Ptr Detect(const Parameters::Accessor& params, DataLocation::Ptr input,
                                  ArchiveCallback& callback) const override
     {
       const auto rawData = input->GetData();
-      if (const auto archive = Decoder->Decode(*rawData))
+      if (const auto archive = Decode(*rawData))
       {
         if (const auto count = archive->CountFiles())
         {
           ContainerDetectCallback detect(~std::size_t(0), Identifier, input, count, callback);
-          archive->ExploreFiles(detect);
+          const auto prefetchFiles = IsArchive() && count > 1 ? GetPrefetchFiles(params) : 0;
+          if (prefetchFiles)
+          {
+            PrefetchingWalker(prefetchFiles, GetPrefetchSize(params)).Explore(*archive, detect);
+          }
+          else
+          {
+            archive->ExploreFiles(detect);
+          }
         }
         return Analysis::CreateMatchedResult(archive->Size());
       }
@@ -146,7 +308,7 @@ namespace ZXTune
                               const Analysis::Path& inPath) const override
     {
       const auto rawData = location->GetData();
-      if (const auto archive = Decoder->Decode(*rawData))
+      if (const auto archive = Decode(*rawData))
       {
         if (const auto fileToOpen = FindFile(*archive, inPath))
         {
@@ -160,11 +322,39 @@ namespace ZXTune
     }
 
   private:
+    Formats::Archived::Container::Ptr Decode(const Binary::Container& rawData) const
+    {
+      const Debug::Trace::Span span(ArchivedDecodeScope);
+      return Decoder->Decode(rawData);
+    }
+
     bool SupportDirectories() const
     {
       return 0 != (Caps & Capabilities::Container::Traits::DIRECTORIES);
     }
 
+    // only archives have really packed files thread-safely depacked on access
+    bool IsArchive() const
+    {
+      return Capabilities::Container::Type::ARCHIVE == (Caps & Capabilities::Container::Type::MASK);
+    }
+
+    static std::size_t GetPrefetchFiles(const Parameters::Accessor& params)
+    {
+      using namespace Parameters::ZXTune::Core::Plugins::Archives;
+      Parameters::IntType files = PREFETCH_FILES_DEFAULT;
+      params.FindValue(PREFETCH_FILES, files);
+      return static_cast<std::size_t>(std::max<Parameters::IntType>(files, 0));
+    }
+
+    static std::size_t GetPrefetchSize(const Parameters::Accessor& params)
+    {
+      using namespace Parameters::ZXTune::Core::Plugins::Archives;
+      Parameters::IntType sizeMb = PREFETCH_SIZE_MB_DEFAULT;
+      params.FindValue(PREFETCH_SIZE_MB, sizeMb);
+      return static_cast<std::size_t>(std::max<Parameters::IntType>(sizeMb, 0)) << 20;
+    }
+
     Formats::Archived::File::Ptr FindFile(const Formats::Archived::Container& container,
                                           const Analysis::Path& path) const
     {
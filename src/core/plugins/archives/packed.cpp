@@ -13,11 +13,15 @@
 #include <core/plugin_attrs.h>
 // common includes
 #include <make_ptr.h>
+// library includes
+#include <debug/trace.h>
 // std includes
 #include <utility>
 
 namespace ZXTune
 {
+  const Debug::Trace::Scope PackedDecodeScope("Core::Packed::Decode");
+
   const String ARCHIVE_PLUGIN_PREFIX("+un");
 
   String EncodeArchivePluginToPath(const String& pluginId)
@@ -69,7 +73,7 @@ namespace ZXTune
                                  ArchiveCallback& callback) const override
     {
       auto rawData = inputData->GetData();
-      if (auto subData = Decoder->Decode(*rawData))
+      if (auto subData = Decode(*rawData))
       {
         const auto packedSize = subData->PackedSize();
         auto subPath = EncodeArchivePluginToPath(Identifier);
@@ -96,7 +100,7 @@ namespace ZXTune
         return {};
       }
       const auto rawData = inputData->GetData();
-      if (auto subData = Decoder->Decode(*rawData))
+      if (auto subData = Decode(*rawData))
       {
         return CreateNestedLocation(std::move(inputData), std::move(subData), std::move(pluginId),
                                     std::move(pathComponent));
@@ -104,6 +108,13 @@ namespace ZXTune
       return {};
     }
 
+  private:
+    Formats::Packed::Container::Ptr Decode(const Binary::Container& rawData) const
+    {
+      const Debug::Trace::Span span(PackedDecodeScope);
+      return Decoder->Decode(rawData);
+    }
+
   private:
     const String Identifier;
     const uint_t Caps;
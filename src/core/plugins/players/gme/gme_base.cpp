@@ -77,14 +77,14 @@ namespace Module::GME
   {
     using Ptr = std::shared_ptr<GMETune>;
 
-    GMETune(EmuCreator create, Binary::Dump data, uint_t track)
+    GMETune(EmuCreator create, Binary::Data::Ptr data, uint_t track)
       : CreateEmu(create)
       , Data(std::move(data))
       , Track(track)
     {}
 
     EmuCreator CreateEmu;
-    Binary::Dump Data;
+    const Binary::Data::Ptr Data;
     uint_t Track;
     Time::Milliseconds Duration;
 
@@ -93,7 +93,7 @@ namespace Module::GME
       const uint_t FAKE_SOUND_FREQUENCY = 30000;
       const auto emu = CreateEmu();
       CheckError(emu->set_sample_rate(FAKE_SOUND_FREQUENCY));
-      CheckError(emu->load_mem(Data.data(), Data.size()));
+      CheckError(emu->load_mem(Data->Start(), Data->Size()));
       ::track_info_t info;
       CheckError(emu->track_info(&info, Track));
       return info;
@@ -125,7 +125,7 @@ namespace Module::GME
       , Track(tune.Track)
     {
       CheckError(Emu->set_sample_rate(samplerate));
-      CheckError(Emu->load_mem(tune.Data.data(), tune.Data.size()));
+      CheckError(Emu->load_mem(tune.Data->Start(), tune.Data->Size()));
       Reset();
     }
 
@@ -271,10 +271,11 @@ namespace Module::GME
   };
 
   // TODO: rework, extract GYM parsing code to Formats library
-  Binary::Dump DefaultDataCreator(Binary::View data)
+  // shares source data, so all the tracks of multitrack module are backed by the single (possibly memory-mapped)
+  // storage
+  Binary::Data::Ptr DefaultDataCreator(const Binary::Container& data)
   {
-    return Binary::Dump(static_cast<const uint8_t*>(data.Start()),
-                        static_cast<const uint8_t*>(data.Start()) + data.Size());
+    return data.GetSubcontainer(0, data.Size());
   }
 
   using PlatformDetector = StringView (*)(Binary::View);
@@ -290,7 +291,8 @@ namespace Module::GME
 
   namespace GYM
   {
-    Binary::Dump CreateData(Binary::View data)
+    // packed tracks are unpacked into private storage
+    Binary::Data::Ptr CreateData(const Binary::Container& data)
     {
       Binary::DataInputStream input(data);
       Binary::DataBuilder output(data.Size());
@@ -306,9 +308,7 @@ namespace Module::GME
         output.Add<le_uint32_t>(0);
         output.Add(input.ReadRestData());
       }
-      Binary::Dump result;
-      output.CaptureResult(result);
-      return result;
+      return output.CaptureResult();
     }
   }  // namespace GYM
 
@@ -347,7 +347,7 @@ namespace Module::GME
       {
         PropertiesHelper props(*properties);
         auto data = Desc.CreateData(container);
-        props.SetPlatform(Desc.DetectPlatform(data));
+        props.SetPlatform(Desc.DetectPlatform(*data));
         auto tune = MakePtr<GMETune>(Desc.CreateEmu, std::move(data), container.StartTrackIndex());
 
         const auto info = tune->GetInfo();
@@ -381,7 +381,7 @@ namespace Module::GME
       {
         PropertiesHelper props(*properties);
         auto data = Desc.CreateData(container);
-        props.SetPlatform(Desc.DetectPlatform(data));
+        props.SetPlatform(Desc.DetectPlatform(*data));
         auto tune = MakePtr<GMETune>(Desc.CreateEmu, std::move(data), 0);
         const auto info = tune->GetInfo();
         GetProperties(info, props);
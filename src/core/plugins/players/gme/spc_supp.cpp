@@ -37,11 +37,11 @@ namespace Module::SPC
   {
     using Ptr = std::shared_ptr<const Model>;
 
-    const Binary::Dump Data;
+    const Binary::Data::Ptr Data;
     const Time::Milliseconds Duration;
 
-    Model(const Binary::Data& data, Time::Milliseconds duration)
-      : Data(static_cast<const uint8_t*>(data.Start()), static_cast<const uint8_t*>(data.Start()) + data.Size())
+    Model(Binary::Data::Ptr data, Time::Milliseconds duration)
+      : Data(std::move(data))
       , Duration(duration)
     {}
   };
@@ -111,7 +111,7 @@ namespace Module::SPC
   public:
     Renderer(Model::Ptr tune, Sound::Converter::Ptr target)
       : Tune(std::move(tune))
-      , Engine(MakePtr<SPC>(Tune->Data))
+      , Engine(MakePtr<SPC>(*Tune->Data))
       , State(MakePtr<TimedState>(Tune->Duration))
       , Target(std::move(target))
     {}
@@ -303,7 +303,7 @@ namespace Module::SPC
           {
             duration = GetDefaultDuration(params);
           }
-          auto tune = MakePtr<Model>(*container, duration);
+          auto tune = MakePtr<Model>(container, duration);
 
           return MakePtr<Holder>(std::move(tune), std::move(properties));
         }
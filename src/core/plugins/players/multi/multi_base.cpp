@@ -14,11 +14,20 @@
 #include <contract.h>
 #include <make_ptr.h>
 // library includes
+#include <core/plugins_parameters.h>
+#include <math/numeric.h>
 #include <parameters/merged_accessor.h>
 #include <parameters/visitor.h>
 #include <sound/loop.h>
 // std includes
 #include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace Module
 {
@@ -135,13 +144,136 @@ namespace Module
     uint_t DoneStreams = 0;
   };
 
+  // Persistent workers executing the same set of jobs once per Run call. Calling thread participates as well.
+  class WorkersPool
+  {
+  public:
+    using Job = std::function<void(std::size_t)>;
+
+    WorkersPool(std::size_t workers, std::size_t jobs, Job job)
+      : Jobs(jobs)
+      , Slots(workers + 1)
+      , Execute(std::move(job))
+    {
+      Workers.reserve(workers);
+      for (std::size_t slot = 1; slot != Slots; ++slot)
+      {
+        Workers.emplace_back(&WorkersPool::WorkProc, this, slot);
+      }
+    }
+
+    ~WorkersPool()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Mutex);
+        Stopped = true;
+      }
+      StartCondition.notify_all();
+      for (auto& worker : Workers)
+      {
+        worker.join();
+      }
+    }
+
+    // Returns when all the jobs are done, rethrows first failure if any
+    void Run()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(Mutex);
+        ++Generation;
+        Pending = Workers.size();
+        Failure = nullptr;
+      }
+      StartCondition.notify_all();
+      auto failure = ExecuteSlot(0);
+      std::unique_lock<std::mutex> lock(Mutex);
+      DoneCondition.wait(lock, [this]() { return Pending == 0; });
+      if (!failure)
+      {
+        failure = Failure;
+      }
+      if (failure)
+      {
+        std::rethrow_exception(failure);
+      }
+    }
+
+  private:
+    void WorkProc(std::size_t slot)
+    {
+      uint_t processed = 0;
+      for (;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(Mutex);
+          StartCondition.wait(lock, [this, processed]() { return Stopped || Generation != processed; });
+          if (Stopped)
+          {
+            return;
+          }
+          processed = Generation;
+        }
+        const auto failure = ExecuteSlot(slot);
+        {
+          const std::lock_guard<std::mutex> lock(Mutex);
+          if (failure && !Failure)
+          {
+            Failure = failure;
+          }
+          if (--Pending == 0)
+          {
+            DoneCondition.notify_one();
+          }
+        }
+      }
+    }
+
+    // Static jobs distribution to keep each delegate on the same thread between frames
+    std::exception_ptr ExecuteSlot(std::size_t slot) noexcept
+    {
+      try
+      {
+        for (auto idx = slot; idx < Jobs; idx += Slots)
+        {
+          Execute(idx);
+        }
+        return {};
+      }
+      catch (...)
+      {
+        return std::current_exception();
+      }
+    }
+
+  private:
+    const std::size_t Jobs;
+    const std::size_t Slots;
+    const Job Execute;
+    std::mutex Mutex;
+    std::condition_variable StartCondition;
+    std::condition_variable DoneCondition;
+    uint_t Generation = 0;
+    std::size_t Pending = 0;
+    bool Stopped = false;
+    std::exception_ptr Failure;
+    std::vector<std::thread> Workers;
+  };
+
   class MultiRenderer : public Renderer
   {
   public:
-    explicit MultiRenderer(RenderersArray delegates)
+    MultiRenderer(RenderersArray delegates, std::size_t threads, std::size_t parallelMinSamples)
       : Delegates(std::move(delegates))
       , Target(Delegates.size())
-    {}
+      , ParallelMinSamples(parallelMinSamples)
+    {
+      if (threads)
+      {
+        Chunks.resize(Delegates.size());
+        Pool.reset(new WorkersPool(std::min(threads, Delegates.size() - 1), Delegates.size(),
+                                   [this](std::size_t idx) { RenderStream(idx); }));
+      }
+    }
 
     State::Ptr GetState() const override
     {
@@ -150,14 +282,14 @@ namespace Module
 
     Sound::Chunk Render(const Sound::LoopParameters& looped) override
     {
-      static const Sound::LoopParameters INFINITE_LOOP{true, 0};
-      for (std::size_t idx = 0, lim = Delegates.size(); idx != lim; ++idx)
+      Looped = looped;
+      if (IsParallelRenderingEfficient())
       {
-        if (Target.NeedStream(idx))
-        {
-          auto data = Delegates[idx]->Render(idx == 0 ? looped : INFINITE_LOOP);
-          Target.MixStream(idx, data);
-        }
+        RenderParallel();
+      }
+      else
+      {
+        RenderSerial();
       }
       return Target.Convert();
     }
@@ -191,12 +323,89 @@ namespace Module
         delegates[idx] =
             holder->CreateRenderer(samplerate, Parameters::CreateMergedAccessor(holder->GetModuleProperties(), params));
       }
-      return MakePtr<MultiRenderer>(std::move(delegates));
+      using namespace Parameters::ZXTune::Core::Plugins::Multi;
+      auto threads = THREADS_DEFAULT;
+      params->FindValue(THREADS, threads);
+      auto minSamples = PARALLEL_MIN_SAMPLES_DEFAULT;
+      params->FindValue(PARALLEL_MIN_SAMPLES, minSamples);
+      return MakePtr<MultiRenderer>(std::move(delegates),
+                                    static_cast<std::size_t>(Math::Clamp<Parameters::IntType>(threads, 0, THREADS_MAX)),
+                                    static_cast<std::size_t>(std::max<Parameters::IntType>(minSamples, 0)));
+    }
+
+  private:
+    const Sound::LoopParameters& GetLoopParameters(std::size_t idx) const
+    {
+      static const Sound::LoopParameters INFINITE_LOOP{true, 0};
+      return idx == 0 ? Looped : INFINITE_LOOP;
+    }
+
+    // Synchronization costs are not amortized on small frames or single stream updates
+    bool IsParallelRenderingEfficient() const
+    {
+      if (!Pool || LastFrameSamples < ParallelMinSamples)
+      {
+        return false;
+      }
+      std::size_t needed = 0;
+      for (std::size_t idx = 0, lim = Delegates.size(); idx != lim; ++idx)
+      {
+        needed += Target.NeedStream(idx);
+      }
+      return needed > 1;
+    }
+
+    void RenderSerial()
+    {
+      std::size_t frameSamples = 0;
+      for (std::size_t idx = 0, lim = Delegates.size(); idx != lim; ++idx)
+      {
+        if (Target.NeedStream(idx))
+        {
+          const auto data = Delegates[idx]->Render(GetLoopParameters(idx));
+          frameSamples = std::max(frameSamples, data.size());
+          Target.MixStream(idx, data);
+        }
+      }
+      LastFrameSamples = frameSamples;
+    }
+
+    void RenderParallel()
+    {
+      Pool->Run();
+      // mix in fixed order for deterministic output
+      std::size_t frameSamples = 0;
+      for (std::size_t idx = 0, lim = Delegates.size(); idx != lim; ++idx)
+      {
+        if (Target.NeedStream(idx))
+        {
+          auto& data = Chunks[idx];
+          frameSamples = std::max(frameSamples, data.size());
+          Target.MixStream(idx, data);
+          data = Sound::Chunk();
+        }
+      }
+      LastFrameSamples = frameSamples;
+    }
+
+    // Called from pool threads, touches only per-stream state
+    void RenderStream(std::size_t idx)
+    {
+      if (Target.NeedStream(idx))
+      {
+        Chunks[idx] = Delegates[idx]->Render(GetLoopParameters(idx));
+      }
     }
 
   private:
     const RenderersArray Delegates;
     CumulativeChunk Target;
+    const std::size_t ParallelMinSamples;
+    Sound::LoopParameters Looped;
+    std::size_t LastFrameSamples = std::numeric_limits<std::size_t>::max();
+    std::vector<Sound::Chunk> Chunks;
+    // should be destroyed first to stop workers
+    std::unique_ptr<WorkersPool> Pool;
   };
 
   class MultiHolder : public Holder
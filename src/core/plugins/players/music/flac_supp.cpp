@@ -23,6 +23,7 @@
 #include <formats/chiptune/music/flac.h>
 #include <module/players/properties_helper.h>
 #include <module/players/properties_meta.h>
+#include <module/players/segments.h>
 #include <module/players/streaming.h>
 #include <sound/resampler.h>
 // 3rdparty
@@ -35,6 +36,9 @@ namespace Module::Flac
 {
   const Debug::Stream Dbg("Core::FlacSupp");
 
+  // ~10s for typical samplerates
+  const uint_t SEGMENT_SAMPLES = 1 << 19;
+
   struct Model
   {
     using RWPtr = std::shared_ptr<Model>;
@@ -162,6 +166,28 @@ namespace Module::Flac
       }
     }
 
+    // Seeking is sample-exact, so segments may be decoded independently
+    std::vector<Sound::Chunk> RenderSegment(uint64_t start, uint_t samples)
+    {
+      Seek(start);
+      std::vector<Sound::Chunk> result;
+      while (samples)
+      {
+        auto frame = RenderFrame();
+        if (frame.empty())
+        {
+          break;
+        }
+        else if (frame.size() > samples)
+        {
+          frame.resize(samples);
+        }
+        samples -= frame.size();
+        result.emplace_back(std::move(frame));
+      }
+      return result;
+    }
+
   private:
     static Binary::DataInputStream& GetStream(void* param)
     {
@@ -312,10 +338,12 @@ namespace Module::Flac
   class Renderer : public Module::Renderer
   {
   public:
-    Renderer(Model::Ptr data, Sound::Converter::Ptr target)
-      : Tune(data)
+    Renderer(Model::Ptr data, Sound::Converter::Ptr target, uint_t decodeThreads)
+      : Data(data)
+      , Tune(data)
       , State(MakePtr<SampledState>(data->TotalSamples, data->Frequency))
       , Target(std::move(target))
+      , Segments(decodeThreads > 1 ? new ParallelSegments<Sound::Chunk>(decodeThreads) : nullptr)
     {}
 
     Module::State::Ptr GetState() const override
@@ -330,12 +358,12 @@ namespace Module::Flac
         return {};
       }
       const auto loops = State->LoopCount();
-      auto frame = Tune.RenderFrame();
+      auto frame = RenderFrame();
       State->Consume(frame.size(), looped);
       frame = Target->Apply(std::move(frame));
       if (State->LoopCount() != loops)
       {
-        Tune.Seek(0);
+        Seek(0);
       }
       return frame;
     }
@@ -344,18 +372,59 @@ namespace Module::Flac
     {
       Tune.Reset();
       State->Reset();
+      if (Segments)
+      {
+        Segments->Clear();
+        NextSegment = 0;
+      }
     }
 
     void SetPosition(Time::AtMillisecond request) override
     {
       State->Seek(request);
-      Tune.Seek(State->AtSample());
+      Seek(State->AtSample());
+    }
+
+  private:
+    Sound::Chunk RenderFrame()
+    {
+      if (!Segments)
+      {
+        return Tune.RenderFrame();
+      }
+      for (; !Segments->IsFull() && NextSegment < Data->TotalSamples; NextSegment += SEGMENT_SAMPLES)
+      {
+        Segments->Add([data = Data, start = NextSegment]() {
+          FlacTune tune(data);
+          return tune.RenderSegment(start, SEGMENT_SAMPLES);
+        });
+      }
+      Sound::Chunk result;
+      Segments->Next(result);
+      return result;
+    }
+
+    void Seek(uint64_t sample)
+    {
+      if (Segments)
+      {
+        Segments->Clear();
+        NextSegment = sample;
+      }
+      else
+      {
+        Tune.Seek(sample);
+      }
     }
 
   private:
+    const Model::Ptr Data;
     FlacTune Tune;
     const SampledState::Ptr State;
     const Sound::Converter::Ptr Target;
+    // offline rendering only
+    const std::unique_ptr<ParallelSegments<Sound::Chunk>> Segments;
+    uint64_t NextSegment = 0;
   };
 
   class Holder : public Module::Holder
@@ -376,9 +445,9 @@ namespace Module::Flac
       return Properties;
     }
 
-    Renderer::Ptr CreateRenderer(uint_t samplerate, Parameters::Accessor::Ptr /*params*/) const override
+    Renderer::Ptr CreateRenderer(uint_t samplerate, Parameters::Accessor::Ptr params) const override
     {
-      return MakePtr<Renderer>(Data, Sound::CreateResampler(Data->Frequency, samplerate));
+      return MakePtr<Renderer>(Data, Sound::CreateResampler(Data->Frequency, samplerate), GetDecodeThreads(*params));
     }
 
   private:
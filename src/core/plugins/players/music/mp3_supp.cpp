@@ -20,14 +20,19 @@
 #include <debug/log.h>
 #include <formats/chiptune/decoders.h>
 #include <formats/chiptune/music/mp3.h>
+#include <math/scale.h>
 #include <module/players/properties_helper.h>
 #include <module/players/properties_meta.h>
+#include <module/players/segments.h>
 #include <module/players/streaming.h>
 #include <sound/resampler.h>
 // 3rdparty
 #define MINIMP3_IMPLEMENTATION
 #define MINIMP3_NONSTANDARD_BUT_LOGICAL
 #include <3rdparty/minimp3/minimp3.h>
+// std includes
+#include <deque>
+#include <mutex>
 
 #define FILE_TAG 04123EA8
 
@@ -36,32 +41,129 @@ namespace Module::Mp3
   const Debug::Stream Dbg("Core::Mp3Supp");
 
   const auto SEEK_PRECISION = Time::Milliseconds(2000);
+  // seek beyond explored part of stream is performed by approximate point if it's closer than this
+  const auto MAX_EXACT_SEEK_WALK = Time::Seconds(60);
+  const auto APPROXIMATE_SEEK_PRECISION = Time::Seconds(10);
+  // ~13s for 44.1kHz layer3
+  const uint_t SEGMENT_FRAMES = 500;
+  // enough to restore bit reservoir and synthesis filters state
+  const uint_t SEGMENT_PREROLL_FRAMES = 10;
 
   struct SeekPoint
   {
-    Time::AtMillisecond Start;
-    uint_t Offset;
+    Time::AtMicrosecond Start;
+    std::size_t Offset;
     uint_t Frames = 1;
 
-    SeekPoint(Time::AtMillisecond start, uint_t offset)
+    SeekPoint(Time::AtMicrosecond start, std::size_t offset)
       : Start(start)
       , Offset(offset)
     {}
 
-    bool operator<(Time::AtMillisecond pos) const
+    bool operator<(Time::AtMicrosecond pos) const
     {
       return Start < pos;
     }
   };
 
+  // Exact points are collected incrementally while stream is traversed from the very beginning (by detection, playback
+  // or seeking). Approximate points are taken from stream header and used to seek far beyond the explored part.
+  class SeekIndex
+  {
+  public:
+    struct Position
+    {
+      Time::AtMicrosecond Start;
+      std::size_t Offset = 0;
+      bool Exact = true;
+    };
+
+    // frames may be preceded by tags
+    void SetFramesStart(std::size_t offset)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (Exact.empty())
+      {
+        Frontier.Offset = offset;
+      }
+    }
+
+    void AddApproximate(Time::AtMicrosecond start, std::size_t offset)
+    {
+      Approximate.emplace_back(start, offset);
+    }
+
+    // Only frames contiguous to the explored part are accounted
+    void AddFrame(Time::AtMicrosecond start, std::size_t offset, std::size_t size, Time::Microseconds duration)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (!(start == Frontier.Start))
+      {
+        return;
+      }
+      if (Exact.empty() || Exact.back().Start + SEEK_PRECISION < start)
+      {
+        Exact.emplace_back(start, offset);
+      }
+      else
+      {
+        Exact.back().Frames++;
+      }
+      Frontier.Start += duration;
+      Frontier.Offset = offset + size;
+    }
+
+    Position Find(Time::AtMicrosecond request) const
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (request < Frontier.Start)
+      {
+        auto lookup = std::lower_bound(Exact.begin(), Exact.end(), request);
+        for (uint_t preFrames = 0; lookup != Exact.begin() && preFrames < 10;)
+        {
+          --lookup;
+          preFrames += lookup->Frames;
+        }
+        return {lookup->Start, lookup->Offset, true};
+      }
+      auto lookup = std::lower_bound(Approximate.begin(), Approximate.end(), request);
+      if (lookup != Approximate.begin()
+          && (--lookup)->Start.Get() > Frontier.Start.Get() + Time::Microseconds(MAX_EXACT_SEEK_WALK).Get())
+      {
+        return {lookup->Start, lookup->Offset, false};
+      }
+      return Frontier;
+    }
+
+    std::size_t GetExactPointsCount() const
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      return Exact.size();
+    }
+
+    void Finalize()
+    {
+      Exact.shrink_to_fit();
+      Approximate.shrink_to_fit();
+    }
+
+  private:
+    mutable std::mutex Guard;
+    std::vector<SeekPoint> Exact;
+    Position Frontier;
+    std::vector<SeekPoint> Approximate;
+  };
+
   struct Model
   {
     using RWPtr = std::shared_ptr<Model>;
     using Ptr = std::shared_ptr<const Model>;
 
-    std::vector<SeekPoint> Lookup;
+    std::size_t FramesStart = 0;
     Time::Microseconds Duration;
     Binary::Data::Ptr Content;
+    // filled lazily by all the renderers
+    mutable SeekIndex Index;
   };
 
   struct FrameSound
@@ -108,6 +210,14 @@ namespace Module::Mp3
   class Mp3Tune
   {
   public:
+    // all the offsets are frames boundaries
+    struct Segment
+    {
+      std::size_t Preroll = 0;
+      std::size_t Start = 0;
+      std::size_t End = 0;
+    };
+
     explicit Mp3Tune(Model::Ptr data)
       : Data(std::move(data))
     {
@@ -120,7 +230,10 @@ namespace Module::Mp3
     void Reset()
     {
       ::mp3dec_init(&Decoder);
-      Offset = Data->Lookup.front().Offset;
+      Offset = Data->FramesStart;
+      Position = {};
+      Exact = true;
+      Walked.clear();
     }
 
     bool IsEnd() const
@@ -130,62 +243,179 @@ namespace Module::Mp3
 
     FrameSound RenderNextFrame()
     {
-      const auto total = Data->Content->Size();
       FrameSound result;
-      mp3dec_frame_info_t info;
-      while (Offset < total)
+      while (!IsEnd() && DecodeFrame(result) && result.Data.empty())
+      {}
+      return result;
+    }
+
+    // Decoder is warmed up by preroll frames to get the same result as for sequential decoding
+    std::vector<FrameSound> RenderSegment(const Segment& segment)
+    {
+      ::mp3dec_init(&Decoder);
+      Offset = segment.Preroll;
+      Exact = false;
+      std::vector<FrameSound> result;
+      FrameSound frame;
+      while (Offset < segment.End)
       {
-        const auto resultSamples = ::mp3dec_decode_frame(&Decoder,
-                                                         static_cast<const uint8_t*>(Data->Content->Start()) + Offset,
-                                                         int(total - Offset), result.GetTarget(), &info);
-        Offset += info.frame_bytes;
-        result.Finalize(resultSamples, info);
-        if (resultSamples || !info.frame_bytes)
+        const auto isPreroll = Offset < segment.Start;
+        if (!DecodeFrame(frame))
         {
           break;
         }
+        else if (!isPreroll && !frame.Data.empty())
+        {
+          result.emplace_back(std::move(frame));
+        }
       }
       return result;
     }
 
+    // Walks through the frames without decoding
+    Segment SkipSegment(uint_t frames)
+    {
+      Segment result;
+      result.Preroll = Walked.empty() ? Offset : Walked.front();
+      result.Start = Offset;
+      for (uint_t frame = 0; frame < frames && SkipFrame(); ++frame)
+      {}
+      result.End = Offset;
+      return result;
+    }
+
     // Returns real position
     Time::AtMicrosecond Seek(Time::AtMillisecond request)
     {
-      Reset();
-      auto lookup = std::lower_bound(Data->Lookup.begin(), Data->Lookup.end(), request);
-      for (uint_t preFrames = 0; lookup != Data->Lookup.begin() && preFrames < 10;)
+      const Time::AtMicrosecond target = request;
+      const auto start = Data->Index.Find(target);
+      ::mp3dec_init(&Decoder);
+      Offset = start.Offset;
+      Position = start.Start;
+      Exact = start.Exact;
+      Walked.clear();
+      while (Position < target && SkipFrame())
+      {}
+      return Position;
+    }
+
+  private:
+    // Returns false if no more frames
+    bool DecodeFrame(FrameSound& result)
+    {
+      const auto total = Data->Content->Size();
+      mp3dec_frame_info_t info;
+      const auto resultSamples = ::mp3dec_decode_frame(&Decoder,
+                                                       static_cast<const uint8_t*>(Data->Content->Start()) + Offset,
+                                                       int(total - Offset), result.GetTarget(), &info);
+      result.Finalize(resultSamples, info);
+      if (resultSamples)
       {
-        --lookup;
-        preFrames += lookup->Frames;
+        Advance(resultSamples, info);
+        return true;
       }
+      Offset += info.frame_bytes;
+      return info.frame_bytes != 0;
+    }
+
+    bool SkipFrame()
+    {
       const auto* raw = static_cast<const uint8_t*>(Data->Content->Start());
-      auto offset = lookup->Offset;
-      auto size = Data->Content->Size() - offset;
-      const Time::AtMicrosecond target = request;
-      Time::AtMicrosecond pos = lookup->Start;
-      while (pos < target)
+      const auto total = Data->Content->Size();
+      while (Offset < total)
       {
         mp3dec_frame_info_t info;
-        if (const auto samples = ::mp3dec_decode_frame(&Decoder, raw + offset, int(size), nullptr, &info))
+        const auto start = Offset;
+        if (const auto samples = ::mp3dec_decode_frame(&Decoder, raw + Offset, int(total - Offset), nullptr, &info))
         {
-          offset += info.frame_bytes;
-          size -= info.frame_bytes;
-          pos += Time::Microseconds::FromRatio(samples, info.hz);
+          Advance(samples, info);
+          if (Walked.size() == SEGMENT_PREROLL_FRAMES)
+          {
+            Walked.pop_front();
+          }
+          Walked.push_back(start);
+          return true;
         }
         else if (!info.frame_bytes)
         {
-          Dbg("Failed to decode frame for seek @0x{:08x}", offset);
+          Dbg("Failed to decode frame @0x{:08x}", Offset);
           break;
         }
+        else
+        {
+          Offset += info.frame_bytes;
+        }
       }
-      Offset = offset;
-      return pos;
+      return false;
+    }
+
+    void Advance(uint_t samples, const mp3dec_frame_info_t& info)
+    {
+      const auto duration = Time::Microseconds::FromRatio(samples, info.hz);
+      if (Exact)
+      {
+        Data->Index.AddFrame(Position, Offset, info.frame_bytes, duration);
+      }
+      Offset += info.frame_bytes;
+      Position += duration;
     }
 
   private:
     const Model::Ptr Data;
     mp3dec_t Decoder;
     std::size_t Offset = 0;
+    Time::AtMicrosecond Position;
+    // position is exact if stream is traversed from the beginning or exact seek point
+    bool Exact = true;
+    // the last frames passed by SkipFrame
+    std::deque<std::size_t> Walked;
+  };
+
+  // Segments are split in rendering thread, so seek index is still filled
+  class ParallelMp3Tune
+  {
+  public:
+    ParallelMp3Tune(Model::Ptr data, uint_t threads)
+      : Data(data)
+      , Walker(std::move(data))
+      , Segments(threads)
+    {}
+
+    void Reset()
+    {
+      Segments.Clear();
+      Walker.Reset();
+    }
+
+    FrameSound RenderNextFrame()
+    {
+      while (!Segments.IsFull() && !Walker.IsEnd())
+      {
+        const auto segment = Walker.SkipSegment(SEGMENT_FRAMES);
+        if (segment.Start == segment.End)
+        {
+          break;
+        }
+        Segments.Add([data = Data, segment]() {
+          Mp3Tune tune(data);
+          return tune.RenderSegment(segment);
+        });
+      }
+      FrameSound result;
+      Segments.Next(result);
+      return result;
+    }
+
+    Time::AtMicrosecond Seek(Time::AtMillisecond request)
+    {
+      Segments.Clear();
+      return Walker.Seek(request);
+    }
+
+  private:
+    const Model::Ptr Data;
+    Mp3Tune Walker;
+    ParallelSegments<FrameSound> Segments;
   };
 
   class MultiFreqResampler
@@ -228,14 +458,16 @@ namespace Module::Mp3
 
   private:
     uint_t TargetFreq;
-    std::vector<std::pair<uint_t, Sound::Converter::Ptr> > Resamplers;
+    std::vector<std::pair<uint_t, Sound::Converter::Ptr>> Resamplers;
   };
 
+  template<class TuneType>
   class Renderer : public Module::Renderer
   {
   public:
-    Renderer(Model::Ptr data, uint_t samplerate)
-      : Tune(data)
+    template<class... TuneArgs>
+    Renderer(Model::Ptr data, uint_t samplerate, TuneArgs&&... tuneArgs)
+      : Tune(data, std::forward<TuneArgs>(tuneArgs)...)
       , State(MakePtr<TimedState>(data->Duration))
       , Target(samplerate)
     {}
@@ -285,7 +517,7 @@ namespace Module::Mp3
     }
 
   private:
-    Mp3Tune Tune;
+    TuneType Tune;
     const TimedState::Ptr State;
     MultiFreqResampler Target;
   };
@@ -308,9 +540,17 @@ namespace Module::Mp3
       return Properties;
     }
 
-    Renderer::Ptr CreateRenderer(uint_t samplerate, Parameters::Accessor::Ptr /*params*/) const override
+    Module::Renderer::Ptr CreateRenderer(uint_t samplerate, Parameters::Accessor::Ptr params) const override
     {
-      return MakePtr<Renderer>(Data, samplerate);
+      const auto threads = GetDecodeThreads(*params);
+      if (threads > 1)
+      {
+        return MakePtr<Renderer<ParallelMp3Tune>>(Data, samplerate, threads);
+      }
+      else
+      {
+        return MakePtr<Renderer<Mp3Tune>>(Data, samplerate);
+      }
     }
 
   private:
@@ -336,16 +576,51 @@ namespace Module::Mp3
 
     void AddFrame(const Formats::Chiptune::Mp3::Frame& frame) override
     {
-      const auto pos = Time::AtMillisecond() + Data->Duration.CastTo<Time::Millisecond>();
-      if (Data->Lookup.empty() || Data->Lookup.back().Start + SEEK_PRECISION < pos)
+      const auto duration = Time::Microseconds::FromRatio(frame.Properties.SamplesCount, frame.Properties.Samplerate);
+      if (!Layout)
       {
-        Data->Lookup.emplace_back(pos, frame.Location.Offset);
+        if (!Data->Duration.Get())
+        {
+          Data->FramesStart = frame.Location.Offset;
+          Data->Index.SetFramesStart(frame.Location.Offset);
+        }
+        Data->Index.AddFrame(Time::AtMicrosecond() + Data->Duration, frame.Location.Offset, frame.Location.Size,
+                             duration);
+      }
+      Data->Duration += duration;
+    }
+
+    // Exact index is built later on demand
+    void SetFramesLayout(const Formats::Chiptune::Mp3::FramesLayout& layout) override
+    {
+      Layout = true;
+      Data->FramesStart = layout.Location.Offset;
+      Data->Index.SetFramesStart(layout.Location.Offset);
+      const auto framesDuration = Time::Microseconds::FromRatio(
+          uint64_t(layout.Properties.SamplesCount) * layout.FramesCount, layout.Properties.Samplerate);
+      const uint64_t total = framesDuration.Get();
+      if (!total)
+      {
+        return;
+      }
+      else if (!layout.SeekTable.empty())
+      {
+        for (const auto& point : layout.SeekTable)
+        {
+          const auto start = Math::Scale(uint64_t(point.Frame), uint64_t(layout.FramesCount), total);
+          Data->Index.AddApproximate(Time::AtMicrosecond(start), point.Offset);
+        }
       }
       else
       {
-        Data->Lookup.back().Frames++;
+        const auto step = Time::Microseconds(APPROXIMATE_SEEK_PRECISION).Get();
+        for (uint64_t start = 0; start < total; start += step)
+        {
+          const auto offset = Math::Scale(start, total, uint64_t(layout.Location.Size));
+          Data->Index.AddApproximate(Time::AtMicrosecond(start), layout.Location.Offset + offset);
+        }
       }
-      Data->Duration += Time::Microseconds::FromRatio(frame.Properties.SamplesCount, frame.Properties.Samplerate);
+      Data->Duration += framesDuration;
     }
 
     void SetContent(Binary::Data::Ptr data)
@@ -361,8 +636,8 @@ namespace Module::Mp3
       }
       else
       {
-        Dbg("Built {} seek points", Data->Lookup.size());
-        Data->Lookup.shrink_to_fit();
+        Dbg("Built {} seek points", Data->Index.GetExactPointsCount());
+        Data->Index.Finalize();
         return Data;
       }
     }
@@ -371,6 +646,7 @@ namespace Module::Mp3
     const Model::RWPtr Data;
     PropertiesHelper& Properties;
     MetaProperties Meta;
+    bool Layout = false;
   };
 
   class Factory : public Module::Factory
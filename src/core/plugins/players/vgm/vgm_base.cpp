@@ -56,26 +56,26 @@ namespace Module::LibVGM
   {
     using Ptr = std::shared_ptr<Model>;
 
-    Model(PlayerCreator create, Binary::View data)
+    // data is shared with source container (possibly memory-mapped file)
+    Model(PlayerCreator create, Binary::Data::Ptr data)
       : CreatePlayer(create)
-      , Data(static_cast<const uint8_t*>(data.Start()), static_cast<const uint8_t*>(data.Start()) + data.Size())
+      , Data(std::move(data))
     {}
 
     PlayerCreator CreatePlayer;
-    Binary::Dump Data;
+    const Binary::Data::Ptr Data;
   };
 
+  // Players access loaded data read-only via DataLoader_GetData, so instead of reading whole data into loader-owned
+  // buffer it's attached in already loaded state
   class LoaderAdapter
   {
   public:
     explicit LoaderAdapter(Binary::View raw)
-      : Raw(raw)
     {
-      std::memset(&Delegate, 0, sizeof(Delegate));
-      static const DATA_LOADER_CALLBACKS CALLBACKS = {0xdeadbeef, "",    &Open,   &Read, nullptr,
-                                                      &Close,     &Tell, &Length, &Eof};
-      ::DataLoader_Setup(&Delegate, &CALLBACKS, this);
-      Require(0 == ::DataLoader_Load(Get()));
+      // callbacks are not used for attached data
+      ::DataLoader_Setup(&Delegate, nullptr, nullptr);
+      ::DataLoader_Attach(&Delegate, raw.As<UINT8>(), static_cast<UINT32>(raw.Size()));
     }
 
     ~LoaderAdapter()
@@ -89,57 +89,7 @@ namespace Module::LibVGM
     }
 
   private:
-    static LoaderAdapter* Cast(void* ctx)
-    {
-      return static_cast<LoaderAdapter*>(ctx);
-    }
-
-    static UINT8 Open(void* ctx)
-    {
-      Cast(ctx)->Position = 0;
-      return 0;
-    }
-
-    static UINT32 Read(void* ctx, UINT8* buf, UINT32 size)
-    {
-      auto* self = Cast(ctx);
-      if (const auto sub = self->Raw.SubView(self->Position, size))
-      {
-        std::memcpy(buf, sub.Start(), sub.Size());
-        self->Position += sub.Size();
-        return sub.Size();
-      }
-      else
-      {
-        return 0;
-      }
-    }
-
-    static UINT8 Close(void* /*ctx*/)
-    {
-      return 0;
-    }
-
-    static INT32 Tell(void* ctx)
-    {
-      return Cast(ctx)->Position;
-    }
-
-    static UINT32 Length(void* ctx)
-    {
-      return Cast(ctx)->Raw.Size();
-    }
-
-    static UINT8 Eof(void* ctx)
-    {
-      const auto* self = Cast(ctx);
-      return self->Position >= self->Raw.Size();
-    }
-
-  private:
-    const Binary::View Raw;
     DATA_LOADER Delegate;
-    std::size_t Position;
   };
 
   const Time::Milliseconds FRAME_DURATION(20);
@@ -151,7 +101,7 @@ namespace Module::LibVGM
 
     VGMEngine(Model::Ptr tune, uint_t samplerate)
       : Tune(std::move(tune))
-      , Loader(Tune->Data)
+      , Loader(*Tune->Data)
       , Delegate(Tune->CreatePlayer())
     {
       Require(0 == Delegate->LoadFile(Loader.Get()));
@@ -380,9 +330,9 @@ namespace Module::VideoGameMusic
         DataBuilder dataBuilder(props);
         if (const auto container = Formats::Chiptune::VideoGameMusic::Parse(rawData, dataBuilder))
         {
-          auto tune = MakePtr<LibVGM::Model>(&LibVGM::Create< ::VGMPlayer>, *container);
+          auto tune = MakePtr<LibVGM::Model>(&LibVGM::Create< ::VGMPlayer>, container);
           // TODO: move to builder
-          props.SetPlatform(DetectPlatform(tune->Data));
+          props.SetPlatform(DetectPlatform(*tune->Data));
 
           props.SetSource(*container);
 
@@ -441,7 +391,7 @@ namespace Module::Sound98
         DataBuilder dataBuilder(props);
         if (const auto container = Formats::Chiptune::Sound98::Parse(rawData, dataBuilder))
         {
-          auto tune = MakePtr<LibVGM::Model>(&LibVGM::Create< ::S98Player>, *container);
+          auto tune = MakePtr<LibVGM::Model>(&LibVGM::Create< ::S98Player>, container);
 
           props.SetSource(*container);
 
@@ -101,6 +101,57 @@ namespace Parameters
           const auto MAX_DEPACKED_FILE_SIZE_MB = PREFIX + "max_depacked_size_mb"_id;
           //@}
         }  // namespace Zip
+
+        //! @brief Archives containers parameters namespace
+        namespace Archives
+        {
+          //! @brief Parameters#ZXTune#Core#Plugins#Archives namespace prefix
+          const auto PREFIX = Plugins::PREFIX + "archives"_id;
+
+          //@{
+          //! @name Files count to be depacked ahead of detection in a single separate thread
+
+          //! Default value. Zero means serial processing
+          const IntType PREFETCH_FILES_DEFAULT = 0;
+          //! Parameter name
+          const auto PREFETCH_FILES = PREFIX + "prefetch_files"_id;
+          //@}
+
+          //@{
+          //! @name Maximal total size of depacked ahead files in Mb
+
+          //! Default value
+          const IntType PREFETCH_SIZE_MB_DEFAULT = 32;
+          //! Parameter name
+          const auto PREFETCH_SIZE_MB = PREFIX + "prefetch_size_mb"_id;
+          //@}
+        }  // namespace Archives
+
+        //! @brief Multidevice modules player parameters namespace
+        namespace Multi
+        {
+          //! @brief Parameters#ZXTune#Core#Plugins#Multi namespace prefix
+          const auto PREFIX = Plugins::PREFIX + "multi"_id;
+
+          //@{
+          //! @name Additional threads count used to render sub-streams concurrently
+
+          //! Default value- serial rendering
+          const IntType THREADS_DEFAULT = 0;
+          const IntType THREADS_MAX = 16;
+          //! Parameter name
+          const auto THREADS = PREFIX + "threads"_id;
+          //@}
+
+          //@{
+          //! @name Minimal frame size in samples to render sub-streams concurrently
+
+          //! Default value
+          const IntType PARALLEL_MIN_SAMPLES_DEFAULT = 256;
+          //! Parameter name
+          const auto PARALLEL_MIN_SAMPLES = PREFIX + "parallel_min_samples"_id;
+          //@}
+        }  // namespace Multi
       }    // namespace Plugins
     }      // namespace Core
   }        // namespace ZXTune
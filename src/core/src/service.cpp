@@ -19,17 +19,22 @@
 #include <make_ptr.h>
 // library includes
 #include <core/additional_files_resolve.h>
+#include <core/core_parameters.h>
 #include <core/service.h>
 #include <debug/log.h>
+#include <debug/trace.h>
 #include <module/attributes.h>
 // std includes
+#include <list>
 #include <map>
+#include <mutex>
 
 #define FILE_TAG 7F50D054
 
 namespace ZXTune
 {
   const Debug::Stream Dbg("Core::Service");
+  const Debug::Trace::Scope DetectScope("Core::Detect");
   using Module::translate;
 
   class LocationSource
@@ -177,6 +182,115 @@ namespace ZXTune
     Module::Holder::Ptr Result;
   };
 
+  // LRU cache of resolved nested locations grouped by root data identity.
+  // Every cached location pins its whole chain up to the root, so the budget is charged for the root data and all
+  // the resolved levels of the group and the whole group is evicted at once. Root address cannot be reused while its
+  // group exists.
+  class LocationsCache
+  {
+  public:
+    explicit LocationsCache(std::size_t limit)
+      : Limit(limit)
+    {}
+
+    //! @return Location for the longest cached prefix of path
+    DataLocation::Ptr Find(const Binary::Container& root, Analysis::Path::Ptr path)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      const auto group = Index.find(&root);
+      if (group == Index.end())
+      {
+        return {};
+      }
+      Groups.splice(Groups.begin(), Groups, group->second);
+      const auto& locations = group->second->Locations;
+      for (auto prefix = std::move(path); prefix && !prefix->Empty(); prefix = prefix->GetParent())
+      {
+        const auto it = locations.find(prefix->AsString());
+        if (it != locations.end())
+        {
+          return it->second;
+        }
+      }
+      return {};
+    }
+
+    //! @param parent location @location is resolved from, nullptr for root
+    void Add(const Binary::Container& root, const DataLocation* parent, DataLocation::Ptr location)
+    {
+      const auto parentPath = parent ? parent->GetPath()->AsString() : String();
+      auto path = location->GetPath()->AsString();
+      const auto size = location->GetData()->Size();
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (0 == Limit || (parent && !HasLocation(root, parentPath, parent)))
+      {
+        // parent's chain is not charged anymore
+        return;
+      }
+      auto& group = GetGroup(root);
+      if (group.Locations.emplace(std::move(path), std::move(location)).second)
+      {
+        group.Size += size;
+        Used += size;
+        Shrink();
+      }
+    }
+
+  private:
+    struct Group
+    {
+      const Binary::Container* Root;
+      std::size_t Size;
+      std::map<String, DataLocation::Ptr> Locations;
+    };
+
+    bool HasLocation(const Binary::Container& root, const String& path, const DataLocation* location) const
+    {
+      const auto group = Index.find(&root);
+      if (group == Index.end())
+      {
+        return false;
+      }
+      const auto& locations = group->second->Locations;
+      const auto it = locations.find(path);
+      return it != locations.end() && it->second.get() == location;
+    }
+
+    Group& GetGroup(const Binary::Container& root)
+    {
+      const auto it = Index.find(&root);
+      if (it != Index.end())
+      {
+        Groups.splice(Groups.begin(), Groups, it->second);
+        return *it->second;
+      }
+      const auto size = root.Size();
+      Groups.push_front({&root, size, {}});
+      Index.emplace(&root, Groups.begin());
+      Used += size;
+      return Groups.front();
+    }
+
+    // May evict just updated group too, its locations are still referenced by caller
+    void Shrink()
+    {
+      while (Used > Limit)
+      {
+        const auto& last = Groups.back();
+        Used -= last.Size;
+        Index.erase(last.Root);
+        Groups.pop_back();
+      }
+    }
+
+  private:
+    const std::size_t Limit;
+    std::mutex Guard;
+    std::size_t Used = 0;
+    std::list<Group> Groups;
+    std::map<const Binary::Container*, std::list<Group>::iterator> Index;
+  };
+
   class ServiceImpl
     : public Service
     , private LocationSource
@@ -184,6 +298,7 @@ namespace ZXTune
   public:
     explicit ServiceImpl(Parameters::Accessor::Ptr params)
       : Params(std::move(params))
+      , Locations(GetLocationsCacheLimit(*Params))
     {}
 
     Binary::Container::Ptr OpenData(Binary::Container::Ptr data, const String& subpath) const override
@@ -225,14 +340,28 @@ namespace ZXTune
   private:
     DataLocation::Ptr OpenLocation(Binary::Container::Ptr data, const String& subpath) const override
     {
-      auto resolvedLocation = CreateLocation(std::move(data));
+      const auto& root = *data;
       const auto sourcePath = Analysis::ParsePath(subpath, Module::SUBPATH_DELIMITER);
-      for (auto unresolved = sourcePath; !unresolved->Empty();)
+      auto resolvedLocation = Locations.Find(root, sourcePath);
+      auto unresolved = sourcePath;
+      if (resolvedLocation)
+      {
+        Dbg("Use cached '{}'", resolvedLocation->GetPath()->AsString());
+        unresolved = sourcePath->Extract(resolvedLocation->GetPath()->AsString());
+      }
+      const DataLocation* cachedParent = resolvedLocation.get();
+      if (!resolvedLocation)
+      {
+        resolvedLocation = CreateLocation(std::move(data));
+      }
+      while (!unresolved->Empty())
       {
         Dbg("Resolving '{}'", unresolved->AsString());
         resolvedLocation = TryToOpenLocation(resolvedLocation, *unresolved);
         if (resolvedLocation)
         {
+          Locations.Add(root, cachedParent, resolvedLocation);
+          cachedParent = resolvedLocation.get();
           unresolved = sourcePath->Extract(resolvedLocation->GetPath()->AsString());
           if (unresolved)
           {
@@ -330,6 +459,7 @@ namespace ZXTune
     {
       for (const auto& plugin : pluginsSet)
       {
+        const Debug::Trace::Span span(DetectScope);
         const auto result = plugin->Detect(*Params, location, callback);
         if (auto usedSize = result->GetMatchedDataSize())
         {
@@ -340,8 +470,17 @@ namespace ZXTune
       return 0;
     }
 
+    static std::size_t GetLocationsCacheLimit(const Parameters::Accessor& params)
+    {
+      using namespace Parameters::ZXTune::Core;
+      Parameters::IntType sizeMb = LOCATIONS_CACHE_SIZE_MB_DEFAULT;
+      params.FindValue(LOCATIONS_CACHE_SIZE_MB, sizeMb);
+      return static_cast<std::size_t>(std::max<Parameters::IntType>(sizeMb, 0)) << 20;
+    }
+
   private:
     const Parameters::Accessor::Ptr Params;
+    mutable LocationsCache Locations;
   };
 
   Service::Ptr Service::Create(Parameters::Accessor::Ptr parameters)
@@ -0,0 +1,409 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Debug tracing implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+// local includes
+#include "trace_real.h"
+// std includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+  using namespace Debug::Trace;
+
+  // environment variable used to switch on tracing, contains name of file to store trace to at exit
+  const char DEBUG_TRACE_VARIABLE[] = "ZXTUNE_DEBUG_TRACE";
+
+  const uint_t MAX_POINTS = 128;
+  const std::size_t BLOCK_EVENTS = 8192;
+  // the rest of spans are only summarized
+  const std::size_t MAX_THREAD_EVENTS = 1 << 20;
+  const std::size_t BUCKETS = std::tuple_size<decltype(Statistic::Buckets)>::value;
+
+  // every thread data has single writer at a time, so plain load/store is enough to keep readers consistent
+  void Increase(std::atomic<uint64_t>& value, uint64_t delta)
+  {
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+  }
+
+  std::size_t GetBucket(uint64_t value)
+  {
+    std::size_t bucket = 0;
+    for (; value; value >>= 1)
+    {
+      ++bucket;
+    }
+    return std::min(bucket, BUCKETS - 1);
+  }
+
+  class PointData
+  {
+  public:
+    void Add(uint64_t value)
+    {
+      Increase(Count, 1);
+      Increase(Sum, value);
+      if (value < Min.load(std::memory_order_relaxed))
+      {
+        Min.store(value, std::memory_order_relaxed);
+      }
+      if (value > Max.load(std::memory_order_relaxed))
+      {
+        Max.store(value, std::memory_order_relaxed);
+      }
+      Increase(Buckets[GetBucket(value)], 1);
+    }
+
+    void CollectTo(Statistic& stat) const
+    {
+      const uint64_t count = Count.load(std::memory_order_relaxed);
+      if (!count)
+      {
+        return;
+      }
+      const uint64_t min = Min.load(std::memory_order_relaxed);
+      stat.Min = stat.Count ? std::min(stat.Min, min) : min;
+      stat.Max = std::max<uint64_t>(stat.Max, Max.load(std::memory_order_relaxed));
+      stat.Count += count;
+      stat.Sum += Sum.load(std::memory_order_relaxed);
+      for (std::size_t idx = 0; idx != BUCKETS; ++idx)
+      {
+        stat.Buckets[idx] += Buckets[idx].load(std::memory_order_relaxed);
+      }
+    }
+
+  private:
+    std::atomic<uint64_t> Count{0};
+    std::atomic<uint64_t> Sum{0};
+    std::atomic<uint64_t> Min{~uint64_t(0)};
+    std::atomic<uint64_t> Max{0};
+    std::array<std::atomic<uint64_t>, BUCKETS> Buckets = {};
+  };
+
+  struct Event
+  {
+    uint_t Point;
+    uint64_t Start;
+    uint64_t Finish;
+  };
+
+  // filled by owner thread, published to readers by Size and Next
+  struct EventsBlock
+  {
+    std::array<Event, BLOCK_EVENTS> Events;
+    std::atomic<std::size_t> Size{0};
+    std::atomic<EventsBlock*> Next{nullptr};
+  };
+
+  class ThreadData
+  {
+  public:
+    explicit ThreadData(uint_t id)
+      : Id(id)
+    {}
+
+    ~ThreadData()
+    {
+      for (auto* block = Head.load(); block;)
+      {
+        std::unique_ptr<EventsBlock> toDelete(block);
+        block = block->Next.load();
+      }
+    }
+
+    uint_t GetId() const
+    {
+      return Id;
+    }
+
+    void AddSpan(uint_t point, uint64_t start, uint64_t finish)
+    {
+      Points[point].Add(finish - start);
+      if (TotalEvents == MAX_THREAD_EVENTS)
+      {
+        return;
+      }
+      if (!Tail || Tail->Size.load(std::memory_order_relaxed) == BLOCK_EVENTS)
+      {
+        auto* block = new EventsBlock();
+        (Tail ? Tail->Next : Head).store(block, std::memory_order_release);
+        Tail = block;
+      }
+      const auto size = Tail->Size.load(std::memory_order_relaxed);
+      Tail->Events[size] = {point, start, finish};
+      Tail->Size.store(size + 1, std::memory_order_release);
+      ++TotalEvents;
+    }
+
+    void AddValue(uint_t point, uint64_t value)
+    {
+      Points[point].Add(value);
+    }
+
+    const PointData& GetPoint(uint_t point) const
+    {
+      return Points[point];
+    }
+
+    template<class Func>
+    void ForEachEvent(Func func) const
+    {
+      for (const auto* block = Head.load(std::memory_order_acquire); block;
+           block = block->Next.load(std::memory_order_acquire))
+      {
+        for (std::size_t idx = 0, lim = block->Size.load(std::memory_order_acquire); idx != lim; ++idx)
+        {
+          func(block->Events[idx]);
+        }
+      }
+    }
+
+  private:
+    const uint_t Id;
+    std::array<PointData, MAX_POINTS> Points;
+    std::atomic<EventsBlock*> Head{nullptr};
+    EventsBlock* Tail = nullptr;
+    std::size_t TotalEvents = 0;
+  };
+
+  void WriteEscaped(const String& str, std::ostream& out)
+  {
+    for (const auto sym : str)
+    {
+      if (sym == '\"' || sym == '\\')
+      {
+        out << '\\';
+      }
+      out << sym;
+    }
+  }
+
+  void WriteMicroseconds(uint64_t nanoseconds, std::ostream& out)
+  {
+    out << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000;
+  }
+
+  class Registry
+  {
+    Registry()
+      : Variable(::getenv(DEBUG_TRACE_VARIABLE))
+      , Enabled(Variable && *Variable)
+      , Start(std::chrono::steady_clock::now())
+    {
+      if (Enabled)
+      {
+        std::atexit([]() { Instance().Flush(); });
+      }
+    }
+
+  public:
+    static Registry& Instance()
+    {
+      // never destroyed to keep detached threads tracing valid at exit
+      static auto* self = new Registry();
+      return *self;
+    }
+
+    bool IsEnabled() const
+    {
+      return Enabled;
+    }
+
+    uint_t RegisterPoint(const char* name, PointType type)
+    {
+      if (!Enabled)
+      {
+        return INVALID_POINT;
+      }
+      const std::lock_guard<std::mutex> lock(Guard);
+      // same points may be declared in several translation units
+      const auto it = std::find_if(Points.begin(), Points.end(), [name, type](const Statistic& point) {
+        return point.Name == name && point.Type == type;
+      });
+      if (it != Points.end())
+      {
+        return static_cast<uint_t>(it - Points.begin());
+      }
+      else if (Points.size() == MAX_POINTS)
+      {
+        return INVALID_POINT;
+      }
+      Points.emplace_back();
+      Points.back().Name = name;
+      Points.back().Type = type;
+      return static_cast<uint_t>(Points.size() - 1);
+    }
+
+    uint64_t Now() const
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count();
+    }
+
+    // data of finished threads is reused by the new ones to keep memory bounded by concurrent threads count
+    ThreadData& GetThreadData()
+    {
+      static thread_local ThreadSlot slot;
+      if (!slot.Data)
+      {
+        slot.Data = AcquireThreadData();
+      }
+      return *slot.Data;
+    }
+
+    std::vector<Statistic> GetSummary() const
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      return CollectSummary();
+    }
+
+    void WriteChromeTrace(std::ostream& out) const
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      out << "{\"traceEvents\":[";
+      bool first = true;
+      const auto startEvent = [&first, &out](const String& name) {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"";
+        WriteEscaped(name, out);
+        out << "\",\"pid\":1,";
+        first = false;
+      };
+      for (const auto& thread : Threads)
+      {
+        thread->ForEachEvent([&](const Event& evt) {
+          startEvent(Points[evt.Point].Name);
+          out << "\"tid\":" << thread->GetId() << ",\"ph\":\"X\",\"ts\":";
+          WriteMicroseconds(evt.Start, out);
+          out << ",\"dur\":";
+          WriteMicroseconds(evt.Finish - evt.Start, out);
+          out << '}';
+        });
+      }
+      const auto now = Now();
+      for (const auto& stat : CollectSummary())
+      {
+        if (stat.Type == COUNTER)
+        {
+          startEvent(stat.Name);
+          out << "\"tid\":0,\"ph\":\"C\",\"ts\":";
+          WriteMicroseconds(now, out);
+          out << ",\"args\":{\"value\":" << stat.Sum << "}}";
+        }
+      }
+      out << "\n]}\n";
+    }
+
+  private:
+    class ThreadSlot
+    {
+    public:
+      ~ThreadSlot()
+      {
+        if (Data)
+        {
+          Instance().ReleaseThreadData(Data);
+        }
+      }
+
+      ThreadData* Data = nullptr;
+    };
+
+    ThreadData* AcquireThreadData()
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (!FreeThreads.empty())
+      {
+        auto* data = FreeThreads.back();
+        FreeThreads.pop_back();
+        return data;
+      }
+      Threads.emplace_back(new ThreadData(static_cast<uint_t>(Threads.size())));
+      return Threads.back().get();
+    }
+
+    void ReleaseThreadData(ThreadData* data)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      FreeThreads.push_back(data);
+    }
+
+    void Flush() const
+    {
+      std::ofstream out(Variable);
+      WriteChromeTrace(out);
+    }
+
+    std::vector<Statistic> CollectSummary() const
+    {
+      auto result = Points;
+      for (const auto& thread : Threads)
+      {
+        for (std::size_t idx = 0, lim = result.size(); idx != lim; ++idx)
+        {
+          thread->GetPoint(static_cast<uint_t>(idx)).CollectTo(result[idx]);
+        }
+      }
+      return result;
+    }
+
+  private:
+    const char* const Variable;
+    const bool Enabled;
+    const std::chrono::steady_clock::time_point Start;
+    mutable std::mutex Guard;
+    // only names and types are used
+    std::vector<Statistic> Points;
+    std::vector<std::unique_ptr<ThreadData>> Threads;
+    std::vector<ThreadData*> FreeThreads;
+  };
+}  // namespace
+
+namespace Debug::Trace
+{
+  bool IsEnabled()
+  {
+    return Registry::Instance().IsEnabled();
+  }
+
+  uint_t RegisterPoint(const char* name, PointType type)
+  {
+    return Registry::Instance().RegisterPoint(name, type);
+  }
+
+  uint64_t Now()
+  {
+    return Registry::Instance().Now();
+  }
+
+  void AddSpan(uint_t point, uint64_t start, uint64_t finish)
+  {
+    Registry::Instance().GetThreadData().AddSpan(point, start, finish);
+  }
+
+  void AddValue(uint_t point, uint64_t value)
+  {
+    Registry::Instance().GetThreadData().AddValue(point, value);
+  }
+
+  std::vector<Statistic> GetSummary()
+  {
+    return Registry::Instance().GetSummary();
+  }
+
+  void WriteChromeTrace(std::ostream& out)
+  {
+    Registry::Instance().WriteChromeTrace(out);
+  }
+}  // namespace Debug::Trace
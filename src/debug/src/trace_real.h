@@ -0,0 +1,126 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Debug tracing implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// local includes
+#include "trace_summary.h"
+
+namespace Debug::Trace
+{
+  //! @brief Checks if tracing is enabled by environment
+  bool IsEnabled();
+
+  //! @brief Registers named trace point, returns INVALID_POINT if tracing is disabled or there are too much points
+  uint_t RegisterPoint(const char* name, PointType type);
+
+  //! @brief Current time point in nanoseconds since tracing start
+  uint64_t Now();
+
+  //! @brief Stores span in calling thread's buffer
+  void AddSpan(uint_t point, uint64_t start, uint64_t finish);
+
+  //! @brief Stores value in calling thread's buffer
+  void AddValue(uint_t point, uint64_t value);
+
+  const uint_t INVALID_POINT = ~uint_t(0);
+
+  /*
+     @brief Named code region
+     @code
+       const Debug::Trace::Scope RenderScope("Sound::Render");
+       ...
+       {
+         const Debug::Trace::Span span(RenderScope);
+         ...
+       }
+     @endcode
+  */
+  class Scope
+  {
+  public:
+    explicit Scope(const char* name)
+      : Point(RegisterPoint(name, SPAN))
+    {}
+
+  private:
+    friend class Span;
+    const uint_t Point;
+  };
+
+  //! @brief Measures lifetime of itself
+  class Span
+  {
+  public:
+    explicit Span(const Scope& scope)
+      : Point(scope.Point)
+      , Start(Point != INVALID_POINT ? Now() : 0)
+    {}
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+    ~Span()
+    {
+      if (Point != INVALID_POINT)
+      {
+        AddSpan(Point, Start, Now());
+      }
+    }
+
+  private:
+    const uint_t Point;
+    const uint64_t Start;
+  };
+
+  class Counter
+  {
+  public:
+    explicit Counter(const char* name)
+      : Point(RegisterPoint(name, COUNTER))
+    {}
+
+    void Add(uint64_t delta = 1) const
+    {
+      if (Point != INVALID_POINT)
+      {
+        AddValue(Point, delta);
+      }
+    }
+
+  private:
+    const uint_t Point;
+  };
+
+  class Histogram
+  {
+  public:
+    explicit Histogram(const char* name)
+      : Point(RegisterPoint(name, HISTOGRAM))
+    {}
+
+    void Add(uint64_t value) const
+    {
+      if (Point != INVALID_POINT)
+      {
+        AddValue(Point, value);
+      }
+    }
+
+  private:
+    const uint_t Point;
+  };
+
+  //! @brief Collects data of all the threads at the moment
+  std::vector<Statistic> GetSummary();
+
+  //! @brief Writes all the collected spans and counters in Chrome trace event format
+  void WriteChromeTrace(std::ostream& out);
+}  // namespace Debug::Trace
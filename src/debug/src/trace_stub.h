@@ -0,0 +1,57 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Debug tracing stub implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// local includes
+#include "trace_summary.h"
+
+namespace Debug::Trace
+{
+  inline bool IsEnabled()
+  {
+    return false;
+  }
+
+  class Scope
+  {
+  public:
+    explicit Scope(const char* /*name*/) {}
+  };
+
+  class Span
+  {
+  public:
+    explicit Span(const Scope& /*scope*/) {}
+  };
+
+  class Counter
+  {
+  public:
+    explicit Counter(const char* /*name*/) {}
+
+    void Add(uint64_t /*delta*/ = 1) const {}
+  };
+
+  class Histogram
+  {
+  public:
+    explicit Histogram(const char* /*name*/) {}
+
+    void Add(uint64_t /*value*/) const {}
+  };
+
+  inline std::vector<Statistic> GetSummary()
+  {
+    return {};
+  }
+
+  inline void WriteChromeTrace(std::ostream& /*out*/) {}
+}  // namespace Debug::Trace
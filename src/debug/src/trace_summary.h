@@ -0,0 +1,44 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Debug tracing summary
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// common includes
+#include <types.h>
+// std includes
+#include <array>
+#include <iosfwd>
+#include <vector>
+
+namespace Debug::Trace
+{
+  enum PointType
+  {
+    //! Duration of code region in nanoseconds
+    SPAN,
+    //! Accumulated value
+    COUNTER,
+    //! Distribution of values
+    HISTOGRAM
+  };
+
+  //! @brief Collected data of single trace point for all the threads
+  struct Statistic
+  {
+    String Name;
+    PointType Type = SPAN;
+    uint64_t Count = 0;
+    uint64_t Sum = 0;
+    uint64_t Min = 0;
+    uint64_t Max = 0;
+    //! Bucket N contains values in range [2^(N-1), 2^N), bucket 0 contains zeroes
+    std::array<uint64_t, 48> Buckets = {};
+  };
+}  // namespace Debug::Trace
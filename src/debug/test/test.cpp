@@ -0,0 +1,205 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Debug library test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <debug/trace.h>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  template<class T>
+  void Test(const std::string& msg, T result, T reference)
+  {
+    if (result == reference)
+    {
+      std::cout << "Passed test for " << msg << std::endl;
+    }
+    else
+    {
+      std::cout << "Failed test for " << msg << " (got: " << result << " expected: " << reference << ")" << std::endl;
+      throw 1;
+    }
+  }
+
+  const char TRACE_FILE[] = "debug_test_trace.json";
+
+  void EnableTracing(const char* file)
+  {
+#ifdef _WIN32
+    ::_putenv_s("ZXTUNE_DEBUG_TRACE", file);
+#else
+    ::setenv("ZXTUNE_DEBUG_TRACE", file, 1);
+#endif
+  }
+
+  const Debug::Trace::Statistic& GetStatistic(const std::vector<Debug::Trace::Statistic>& summary,
+                                              const std::string& name)
+  {
+    const auto it = std::find_if(summary.begin(), summary.end(),
+                                 [&name](const Debug::Trace::Statistic& stat) { return stat.Name == name; });
+    if (it == summary.end())
+    {
+      std::cout << "No statistic for " << name << std::endl;
+      throw 1;
+    }
+    return *it;
+  }
+
+  std::size_t CountOf(const std::string& str, const std::string& substr)
+  {
+    std::size_t result = 0;
+    for (auto pos = str.find(substr); pos != std::string::npos; pos = str.find(substr, pos + 1))
+    {
+      ++result;
+    }
+    return result;
+  }
+
+  void DoSpans(const Debug::Trace::Scope& scope, uint_t count)
+  {
+    for (uint_t idx = 0; idx != count; ++idx)
+    {
+      const Debug::Trace::Span span(scope);
+    }
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    // trace is written at exit by handler registered at first usage, so it's removed after that
+    std::atexit([]() { std::remove(TRACE_FILE); });
+    // tracing state is captured at first usage
+    EnableTracing(TRACE_FILE);
+    Test("IsEnabled", Debug::Trace::IsEnabled(), true);
+
+    const Debug::Trace::Scope scope("Test::Span");
+    const Debug::Trace::Scope sameScope("Test::Span");
+    const Debug::Trace::Scope quotedScope("Test::\"Quoted\\\"");
+    const Debug::Trace::Counter counter("Test::Counter");
+    const Debug::Trace::Histogram histogram("Test::Histogram");
+
+    DoSpans(scope, 3);
+    DoSpans(sameScope, 2);
+    DoSpans(quotedScope, 1);
+    counter.Add(5);
+    counter.Add();
+    histogram.Add(0);
+    histogram.Add(1);
+    histogram.Add(1000);
+    // sequential threads reuse the same data
+    for (uint_t thr = 0; thr != 4; ++thr)
+    {
+      std::thread([&scope]() { DoSpans(scope, 10); }).join();
+    }
+    {
+      // hold the data until all the threads get their own
+      std::atomic<uint_t> started{0};
+      std::vector<std::thread> threads;
+      for (uint_t thr = 0; thr != 2; ++thr)
+      {
+        threads.emplace_back([&scope, &counter, &started]() {
+          DoSpans(scope, 1);
+          for (++started; started != 2;)
+          {
+            std::this_thread::yield();
+          }
+          DoSpans(scope, 9);
+          counter.Add(10);
+        });
+      }
+      for (auto& thr : threads)
+      {
+        thr.join();
+      }
+    }
+
+    const auto summary = Debug::Trace::GetSummary();
+    Test<std::size_t>("Points count", summary.size(), 4);
+    {
+      const auto& stat = GetStatistic(summary, "Test::Span");
+      Test("Span type", stat.Type, Debug::Trace::SPAN);
+      Test<uint64_t>("Span count", stat.Count, 65);
+      Test("Span min/max", stat.Min <= stat.Max, true);
+    }
+    {
+      const auto& stat = GetStatistic(summary, "Test::Counter");
+      Test("Counter type", stat.Type, Debug::Trace::COUNTER);
+      Test<uint64_t>("Counter count", stat.Count, 4);
+      Test<uint64_t>("Counter sum", stat.Sum, 26);
+    }
+    {
+      const auto& stat = GetStatistic(summary, "Test::Histogram");
+      Test("Histogram type", stat.Type, Debug::Trace::HISTOGRAM);
+      Test<uint64_t>("Histogram count", stat.Count, 3);
+      Test<uint64_t>("Histogram sum", stat.Sum, 1001);
+      Test<uint64_t>("Histogram min", stat.Min, 0);
+      Test<uint64_t>("Histogram max", stat.Max, 1000);
+      Test<uint64_t>("Histogram bucket 0", stat.Buckets[0], 1);
+      Test<uint64_t>("Histogram bucket 1", stat.Buckets[1], 1);
+      Test<uint64_t>("Histogram bucket 10", stat.Buckets[10], 1);
+      Test<uint64_t>("Histogram buckets", std::count(stat.Buckets.begin(), stat.Buckets.end(), 0), 45);
+    }
+
+    std::ostringstream out;
+    Debug::Trace::WriteChromeTrace(out);
+    const auto trace = out.str();
+    const std::string header = "{\"traceEvents\":[\n";
+    const std::string footer = "\n]}\n";
+    Test("Trace header", trace.substr(0, header.size()), header);
+    Test("Trace footer", trace.substr(trace.size() - footer.size()), footer);
+    Test<std::size_t>("Trace spans", CountOf(trace, "\"name\":\"Test::Span\","), 65);
+    Test<std::size_t>("Trace escaping", CountOf(trace, "\"name\":\"Test::\\\"Quoted\\\\\\\"\","), 1);
+    Test<std::size_t>("Trace main thread", CountOf(trace, "\"tid\":0,\"ph\":\"X\""), 6);
+    Test<std::size_t>("Trace reused thread", CountOf(trace, "\"tid\":1,\"ph\":\"X\""), 50);
+    Test<std::size_t>("Trace concurrent thread", CountOf(trace, "\"tid\":2,\"ph\":\"X\""), 10);
+    Test<std::size_t>("Trace counter", CountOf(trace, "\"ph\":\"C\""), 1);
+    const std::regex span(
+        R"(\{"name":"(?:[^"\\]|\\.)*","pid":1,"tid":\d+,"ph":"X","ts":\d+\.\d{3},"dur":\d+\.\d{3}\})");
+    const std::regex value(
+        R"(\{"name":"Test::Counter","pid":1,"tid":0,"ph":"C","ts":\d+\.\d{3},"args":\{"value":26\}\})");
+    std::istringstream lines(trace.substr(header.size(), trace.size() - header.size() - footer.size()));
+    uint_t spans = 0;
+    uint_t values = 0;
+    for (std::string line; std::getline(lines, line);)
+    {
+      if (!line.empty() && line.back() == ',')
+      {
+        line.pop_back();
+      }
+      if (std::regex_match(line, span))
+      {
+        ++spans;
+      }
+      else if (std::regex_match(line, value))
+      {
+        ++values;
+      }
+      else
+      {
+        Test<std::string>("Trace event", line, "valid");
+      }
+    }
+    Test<uint_t>("Trace span events", spans, 66);
+    Test<uint_t>("Trace value events", values, 1);
+  }
+  catch (int code)
+  {
+    return code;
+  }
+}
@@ -0,0 +1,17 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Debug tracing functions interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+#ifdef NO_DEBUG_TRACES
+#  include "src/trace_stub.h"
+#else
+#  include "src/trace_real.h"
+#endif
@@ -14,10 +14,13 @@
 #include "renderers.h"
 #include "volume_table.h"
 // library includes
+#include <debug/trace.h>
 #include <parameters/tracking_helper.h>
 
 namespace Devices::AYM
 {
+  const Debug::Trace::Scope RenderTillScope("Devices::AYM::RenderTill");
+
   template<class Traits>
   class SoundChip : public Traits::ChipBaseType
   {
@@ -76,6 +79,7 @@ namespace Devices::AYM
 
     Sound::Chunk RenderTill(Stamp stamp) override
     {
+      const Debug::Trace::Span span(RenderTillScope);
       Sound::Chunk result;
       if (RenderedData.empty())
       {
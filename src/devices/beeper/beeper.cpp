@@ -12,35 +12,147 @@
 #include <make_ptr.h>
 // local includes
 #include <devices/beeper.h>
-#include <devices/details/renderers.h>
 #include <parameters/tracking_helper.h>
 // std includes
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <numeric>
 #include <utility>
 
 namespace Devices::Beeper
 {
-  class BeeperPSG
+  /*
+    Every level change is rendered as band-limited step: windowed sinc impulse response placed at exact sub-sample
+    position is added to the following samples and integrated at output. Time is measured in 1/soundFreq microseconds
+    to keep sample boundaries integer. Output is delayed by half of response length.
+  */
+  class BandLimitedRenderer
   {
+    static const uint_t TAPS = 32;
+    static const uint_t PHASES = 64;
+    static const uint_t PRECISION_BITS = 15;
+
+    using Response = std::array<std::array<int_t, TAPS>, PHASES>;
+
   public:
-    void SetNewData(bool level)
+    BandLimitedRenderer()
+      : Kernel(GetKernel())
     {
-      Levels = level ? Sound::Sample(Sound::Sample::MAX / 4, Sound::Sample::MAX / 4) : Sound::Sample();
+      Reset();
     }
 
-    void Tick(uint_t /*ticks*/) {}
+    void SetSoundFreq(uint_t soundFreq)
+    {
+      SoundFreq = soundFreq;
+      // first sample not earlier than current time
+      const auto curTime = LastStamp.Get() * SoundFreq;
+      NextSampleTime = (curTime + SAMPLE_PERIOD - 1) / SAMPLE_PERIOD * SAMPLE_PERIOD;
+    }
 
-    Sound::Sample GetLevels() const
+    void SetLevel(Stamp stamp, bool level, Sound::Chunk* target)
     {
-      return Levels;
+      Advance(stamp, target);
+      if (level != Level)
+      {
+        AddStep(level ? 1 : -1);
+        Level = level;
+      }
+    }
+
+    void Render(Stamp till, Sound::Chunk* target)
+    {
+      Advance(till, target);
     }
 
     void Reset()
     {
-      Levels = Sound::Sample();
+      Level = false;
+      LastStamp = {};
+      Deltas.fill(0);
+      Position = 0;
+      Accumulator = 0;
+      SetSoundFreq(SoundFreq);
     }
 
   private:
-    Sound::Sample Levels;
+    void Advance(Stamp till, Sound::Chunk* target)
+    {
+      if (!(LastStamp < till))
+      {
+        return;
+      }
+      LastStamp = till;
+      const auto tillTime = till.Get() * SoundFreq;
+      for (; NextSampleTime < tillTime; NextSampleTime += SAMPLE_PERIOD)
+      {
+        auto& delta = Deltas[Position];
+        Accumulator += delta;
+        delta = 0;
+        Position = (Position + 1) % TAPS;
+        const auto val = static_cast<Sound::Sample::Type>((Accumulator * MAX_LEVEL) >> PRECISION_BITS);
+        target->push_back(Sound::Sample(val, val));
+      }
+    }
+
+    // step happens not later than the next sample and after the previous one
+    void AddStep(int_t sign)
+    {
+      const auto offset = NextSampleTime - LastStamp.Get() * SoundFreq;
+      assert(offset < SAMPLE_PERIOD);
+      const auto& response = Kernel[offset * PHASES / SAMPLE_PERIOD];
+      for (uint_t tap = 0; tap != TAPS; ++tap)
+      {
+        Deltas[(Position + tap) % TAPS] += sign * response[tap];
+      }
+    }
+
+    static const Response& GetKernel()
+    {
+      static const Response INSTANCE = CreateKernel();
+      return INSTANCE;
+    }
+
+    // Blackman-windowed sinc, every phase is normalized to have exactly unit step
+    static Response CreateKernel()
+    {
+      const double PI = 3.14159265358979323846;
+      // relative to sample rate, so the stopband starts near Nyquist frequency
+      const double CUTOFF = 0.4;
+      Response result;
+      for (uint_t phase = 0; phase != PHASES; ++phase)
+      {
+        std::array<double, TAPS> impulse;
+        for (uint_t tap = 0; tap != TAPS; ++tap)
+        {
+          const double pos = double(tap) - TAPS / 2 + double(phase) / PHASES;
+          const double arg = 2 * PI * CUTOFF * pos;
+          const double sinc = arg != 0 ? std::sin(arg) / arg : 1.0;
+          const double window = 0.42 + 0.5 * std::cos(2 * PI * pos / TAPS) + 0.08 * std::cos(4 * PI * pos / TAPS);
+          impulse[tap] = sinc * window;
+        }
+        const double sum = std::accumulate(impulse.begin(), impulse.end(), 0.0);
+        int_t total = 0;
+        for (uint_t tap = 0; tap != TAPS; ++tap)
+        {
+          total += result[phase][tap] = static_cast<int_t>(std::lround(impulse[tap] / sum * (1 << PRECISION_BITS)));
+        }
+        result[phase][TAPS / 2] += (1 << PRECISION_BITS) - total;
+      }
+      return result;
+    }
+
+  private:
+    static const uint64_t SAMPLE_PERIOD = Stamp::PER_SECOND;
+    static const int_t MAX_LEVEL = Sound::Sample::MAX / 4;
+    const Response& Kernel;
+    uint_t SoundFreq = 0;
+    Stamp LastStamp;
+    bool Level = false;
+    uint64_t NextSampleTime = 0;
+    std::array<int_t, TAPS> Deltas;
+    uint_t Position = 0;
+    int_t Accumulator = 0;
   };
 
   class ChipImpl : public Chip
@@ -48,44 +160,23 @@ namespace Devices::Beeper
   public:
     explicit ChipImpl(ChipParameters::Ptr params)
       : Params(std::move(params))
-      , Renderer(Clock, PSG)
-      , ClockFreq()
-      , SoundFreq()
     {
       SynchronizeParameters();
     }
 
     void RenderData(const std::vector<DataChunk>& src) override
     {
-      if (src.empty())
-      {
-        return;
-      }
-      const Stamp end = src.back().TimeStamp;
-      if (Clock.HasSamplesBefore(end))
-      {
-        RenderedData.reserve(RenderedData.size() + Clock.SamplesTill(end));
-        for (const auto& chunk : src)
-        {
-          Renderer.Render(chunk.TimeStamp, &RenderedData);
-          PSG.SetNewData(chunk.Level);
-        }
-      }
-      else
+      for (const auto& chunk : src)
       {
-        for (const auto& chunk : src)
-        {
-          PSG.SetNewData(chunk.Level);
-        }
+        Renderer.SetLevel(chunk.TimeStamp, chunk.Level, &RenderedData);
       }
     }
 
     void Reset() override
     {
       Params.Reset();
-      PSG.Reset();
-      Clock.Reset();
-      ClockFreq = 0;
+      Renderer.Reset();
+      RenderedData.clear();
       SoundFreq = 0;
       SynchronizeParameters();
     }
@@ -93,16 +184,9 @@ namespace Devices::Beeper
     Sound::Chunk RenderTill(Stamp stamp) override
     {
       Sound::Chunk result;
-      if (RenderedData.empty())
-      {
-        result = Renderer.Render(stamp, Clock.SamplesTill(stamp));
-      }
-      else
-      {
-        Renderer.Render(stamp, &RenderedData);
-        result.swap(RenderedData);
-        RenderedData.reserve(result.size());
-      }
+      Renderer.Render(stamp, &RenderedData);
+      result.swap(RenderedData);
+      RenderedData.reserve(result.size());
       SynchronizeParameters();
       return result;
     }
@@ -112,23 +196,19 @@ namespace Devices::Beeper
     {
       if (Params.IsChanged())
       {
-        const uint64_t clkFreq = Params->ClockFreq();
         const uint_t sndFreq = Params->SoundFreq();
-        if (clkFreq != ClockFreq || sndFreq != SoundFreq)
+        if (sndFreq != SoundFreq)
         {
-          Clock.SetFrequency(clkFreq, sndFreq);
-          Renderer.SetClockFrequency(clkFreq);
+          SoundFreq = sndFreq;
+          Renderer.SetSoundFreq(sndFreq);
         }
       }
     }
 
   private:
     Parameters::TrackingHelper<ChipParameters> Params;
-    BeeperPSG PSG;
-    Details::ClockSource<Stamp> Clock;
-    Details::HQRenderer<Stamp, BeeperPSG> Renderer;
-    uint64_t ClockFreq;
-    uint_t SoundFreq;
+    BandLimitedRenderer Renderer;
+    uint_t SoundFreq = 0;
     Sound::Chunk RenderedData;
   };
 
@@ -764,6 +764,15 @@ inline void chan_calc(FM_STATE* state, FM_CH *CH)
 	CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
 }
 
+/* channel stays silent until key on: all the operators are off and feedback/delayed values are flushed.
+   Phase is restarted by key on, so it may be not advanced meanwhile */
+inline int chan_is_idle(const FM_CH *CH)
+{
+	return CH->SLOT[SLOT1].state == EG_OFF && CH->SLOT[SLOT2].state == EG_OFF
+		&& CH->SLOT[SLOT3].state == EG_OFF && CH->SLOT[SLOT4].state == EG_OFF
+		&& !CH->op1_out[0] && !CH->op1_out[1] && !CH->mem_value;
+}
+
 /* update phase increment and envelope generator */
 inline void refresh_fc_eg_slot(FM_SLOT *SLOT , int fc , int kc )
 {
@@ -1229,6 +1238,8 @@ void YM2203UpdateOne(void *chip, int32_t *buffer, int length)
 	FM_OPN *OPN =   &F2203->OPN;
 	FM_STATE *state = &F2203->State;
 	FM_CH	*cch[3];
+	FM_CH	*active[3];
+	int	activeCount = 0, c;
 
 	cch[0]   = &F2203->CH[0];
 	cch[1]   = &F2203->CH[1];
@@ -1249,6 +1260,13 @@ void YM2203UpdateOne(void *chip, int32_t *buffer, int length)
 		}
 	}else refresh_fc_eg_chan( cch[2] );
 
+	/* idle channels cannot be keyed on while rendering, so they are skipped for the whole block */
+	for (c = 0; c < 3; ++c)
+	{
+		if (!chan_is_idle(cch[c]))
+			active[activeCount++] = cch[c];
+	}
+
 	/* buffering */
 	for (int32_t* buf = buffer, *lim = buffer + length; buf != lim; ++buf)
 	{
@@ -1261,15 +1279,13 @@ void YM2203UpdateOne(void *chip, int32_t *buffer, int length)
 			OPN->eg_timer -= OPN->eg_timer_overflow;
 			OPN->eg_cnt++;
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
+			for (c = 0; c < activeCount; ++c)
+				advance_eg_channel(OPN, &active[c]->SLOT[SLOT1]);
 		}
 
 		/* calculate FM */
-		chan_calc(state, cch[0] );
-		chan_calc(state, cch[1] );
-		chan_calc(state, cch[2] );
+		for (c = 0; c < activeCount; ++c)
+			chan_calc(state, active[c]);
 
 		*buf += state->out_fm[0] + state->out_fm[1] + state->out_fm[2];
 	}
@@ -88,9 +88,11 @@ namespace Devices::FM
         return ChipPtr(::YM2203Init(LastClockrate, LastSoundFreq), &::YM2203Shutdown);
       }
 
+      // output of several chips is averaged in the same pass
+      template<int ChipsCount = 1>
       static void ConvertSamples(const YM2203SampleType* inBegin, const YM2203SampleType* inEnd, Sound::Sample* out)
       {
-        std::transform(inBegin, inEnd, out, &ConvertToSample);
+        std::transform(inBegin, inEnd, out, [](YM2203SampleType level) { return ConvertToSample(level / ChipsCount); });
       }
 
     private:
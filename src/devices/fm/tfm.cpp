@@ -54,8 +54,7 @@ namespace Devices::TFM
       auto* const outRaw = safe_ptr_cast<FM::Details::YM2203SampleType*>(result.data());
       ::YM2203UpdateOne(Chips[0].get(), outRaw, count);
       ::YM2203UpdateOne(Chips[1].get(), outRaw, count);
-      std::transform(outRaw, outRaw + count, outRaw, [](FM::Details::YM2203SampleType s) { return s / 2; });
-      Helper.ConvertSamples(outRaw, outRaw + count, result.data());
+      Helper.ConvertSamples<TFM::CHIPS>(outRaw, outRaw + count, result.data());
       return result;
     }
 
@@ -16,6 +16,7 @@
 #include <contract.h>
 #include <make_ptr.h>
 // library includes
+#include <debug/trace.h>
 #include <devices/details/renderers.h>
 #include <parameters/tracking_helper.h>
 #include <sound/lpfilter.h>
@@ -30,6 +31,8 @@
 
 namespace Devices::SAA
 {
+  const Debug::Trace::Scope RenderTillScope("Devices::SAA::RenderTill");
+
   static_assert(Registers::TOTAL <= 8 * sizeof(uint_t), "Too many registers for mask");
   static_assert(sizeof(Registers) == 32, "Invalid layout");
 
@@ -263,6 +266,7 @@ namespace Devices::SAA
 
     Sound::Chunk RenderTill(Stamp stamp) override
     {
+      const Debug::Trace::Span span(RenderTillScope);
       const uint_t samples = Clock.SamplesTill(stamp);
       Require(samples);
       auto result = Renderers.Render(stamp, samples);
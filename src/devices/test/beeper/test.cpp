@@ -0,0 +1,185 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Beeper spectral purity test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include <cmath>
+#include <complex>
+#include <devices/beeper.h>
+#include <error.h>
+#include <iomanip>
+#include <iostream>
+#include <make_ptr.h>
+
+#define FILE_TAG 3B6E0A25
+
+namespace
+{
+  using namespace Devices::Beeper;
+
+  const double PI = 3.14159265358979323846;
+  const uint_t SPECTRUM_SIZE = 32768;
+  // bins around harmonic considered as its part due to window leakage
+  const uint_t HARMONIC_WIDTH = 4;
+  // 1/4 of 20ms frame
+  const uint_t HALF_PERIOD_US = 161;
+  const uint_t FRAME_US = 20000;
+
+  class ChipParametersStub : public ChipParameters
+  {
+  public:
+    explicit ChipParametersStub(uint_t soundFreq)
+      : Freq(soundFreq)
+    {}
+
+    uint_t Version() const override
+    {
+      return 1;
+    }
+
+    uint64_t ClockFreq() const override
+    {
+      return 3500000 / 10;
+    }
+
+    uint_t SoundFreq() const override
+    {
+      return Freq;
+    }
+
+  private:
+    const uint_t Freq;
+  };
+
+  std::vector<double> RenderSquare(uint_t soundFreq)
+  {
+    const auto chip = CreateChip(MakePtr<ChipParametersStub>(soundFreq));
+    std::vector<double> result;
+    bool level = false;
+    uint_t nextToggle = HALF_PERIOD_US;
+    for (uint_t frameEnd = FRAME_US; result.size() < SPECTRUM_SIZE; frameEnd += FRAME_US)
+    {
+      std::vector<DataChunk> chunks;
+      for (; nextToggle < frameEnd; nextToggle += HALF_PERIOD_US)
+      {
+        chunks.emplace_back(Stamp(nextToggle), level = !level);
+      }
+      chip->RenderData(chunks);
+      for (const auto& sample : chip->RenderTill(Stamp(frameEnd)))
+      {
+        result.push_back(sample.Left());
+      }
+    }
+    result.resize(SPECTRUM_SIZE);
+    return result;
+  }
+
+  // iterative radix-2 transform of Hann-windowed data
+  std::vector<double> GetPowerSpectrum(const std::vector<double>& samples)
+  {
+    const auto size = samples.size();
+    double mean = 0;
+    for (const auto smp : samples)
+    {
+      mean += smp / size;
+    }
+    std::vector<std::complex<double>> data(size);
+    for (std::size_t idx = 0, rev = 0; idx != size; ++idx)
+    {
+      const auto window = 0.5 - 0.5 * std::cos(2 * PI * idx / size);
+      data[rev] = (samples[idx] - mean) * window;
+      for (auto bit = size >> 1; (rev ^= bit) < bit; bit >>= 1)
+      {}
+    }
+    for (std::size_t len = 2; len <= size; len <<= 1)
+    {
+      const auto step = std::polar(1.0, -2 * PI / len);
+      for (std::size_t start = 0; start != size; start += len)
+      {
+        std::complex<double> factor(1);
+        for (std::size_t idx = 0; idx != len / 2; ++idx, factor *= step)
+        {
+          const auto odd = data[start + idx + len / 2] * factor;
+          data[start + idx + len / 2] = data[start + idx] - odd;
+          data[start + idx] += odd;
+        }
+      }
+    }
+    std::vector<double> result(size / 2);
+    for (std::size_t idx = 0; idx != result.size(); ++idx)
+    {
+      result[idx] = std::norm(data[idx]);
+    }
+    return result;
+  }
+
+  // ratio of square wave harmonics power to the power of aliases and other spurious components
+  double GetPurity(const std::vector<double>& spectrum, uint_t soundFreq)
+  {
+    const double binsPerHarmonic = 1e6 / (2 * HALF_PERIOD_US) * SPECTRUM_SIZE / soundFreq;
+    double harmonics = 0;
+    double spurious = 0;
+    for (std::size_t bin = HARMONIC_WIDTH + 1; bin < spectrum.size(); ++bin)
+    {
+      const auto harmonic = std::round(bin / binsPerHarmonic);
+      const bool isHarmonic = std::fmod(harmonic, 2) == 1
+                              && std::abs(bin - harmonic * binsPerHarmonic) <= HARMONIC_WIDTH;
+      (isHarmonic ? harmonics : spurious) += spectrum[bin];
+    }
+    return 10 * std::log10(harmonics / spurious);
+  }
+
+  void TestPurity(uint_t soundFreq, double minPurity)
+  {
+    std::cout << "Test for " << soundFreq << "Hz: ";
+    const auto purity = GetPurity(GetPowerSpectrum(RenderSquare(soundFreq)), soundFreq);
+    std::cout << std::fixed << std::setprecision(1) << purity << "dB" << std::endl;
+    if (purity < minPurity)
+    {
+      throw Error(THIS_LINE, "Too much aliasing");
+    }
+  }
+
+  // level change at the same time as sample starts
+  void TestStepAtStart()
+  {
+    std::cout << "Test for step at start: ";
+    const uint_t soundFreq = 44100;
+    const auto chip = CreateChip(MakePtr<ChipParametersStub>(soundFreq));
+    chip->RenderData({DataChunk(Stamp(0), true)});
+    const auto first = chip->RenderTill(Stamp(FRAME_US));
+    const auto second = chip->RenderTill(Stamp(2 * FRAME_US));
+    const auto samplesPerFrame = FRAME_US * soundFreq / 1000000;
+    if (first.size() != samplesPerFrame || second.size() != samplesPerFrame)
+    {
+      throw Error(THIS_LINE, "Invalid samples count");
+    }
+    if (first.front().Left() != 0 || second.back().Left() != Sound::Sample::MAX / 4)
+    {
+      throw Error(THIS_LINE, "Invalid levels");
+    }
+    std::cout << "Succeed" << std::endl;
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    TestStepAtStart();
+    TestPurity(44100, 40);
+    TestPurity(48000, 40);
+    std::cout << "Succeed" << std::endl;
+  }
+  catch (const Error& err)
+  {
+    std::cout << "Failed: \n";
+    std::cerr << err.ToString();
+    return 1;
+  }
+}
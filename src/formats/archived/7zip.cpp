@@ -23,10 +23,15 @@
 #include <3rdparty/lzma/C/7z.h>
 #include <3rdparty/lzma/C/7zCrc.h>
 // std includes
+#include <algorithm>
 #include <cstring>
-#include <list>
+#include <deque>
+#include <future>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <thread>
 
 namespace Formats::Archived
 {
@@ -160,21 +165,47 @@ namespace Formats::Archived
       SeekStream Stream;
     };
 
+    // Keeps recently decoded folders alive (at least the last one) to serve sequential access
+    class RecentFolders
+    {
+    public:
+      void Add(Binary::Container::Ptr data)
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        Used += data->Size();
+        Items.emplace_front(std::move(data));
+        while (Items.size() > 1 && Used > MAX_SIZE)
+        {
+          Used -= Items.back()->Size();
+          Items.pop_back();
+        }
+      }
+
+    private:
+      static const std::size_t MAX_SIZE = 64 << 20;
+
+      std::mutex Guard;
+      std::deque<Binary::Container::Ptr> Items;
+      std::size_t Used = 0;
+    };
+
+    // Thread-safe. Every folder is decoded at most once while any of its members are referenced.
     class Archive
     {
     public:
       typedef std::shared_ptr<const Archive> Ptr;
 
       explicit Archive(Binary::Data::Ptr data)
-        : Stream(std::move(data))
+        : Data(std::move(data))
       {
+        LookupStream stream(Data);
         SzArEx_Init(&Db);
-        CheckError(SzArEx_Open(&Db, &Stream.s, LzmaContext::Allocator(), LzmaContext::Allocator()));
+        CheckError(SzArEx_Open(&Db, &stream.s, LzmaContext::Allocator(), LzmaContext::Allocator()));
+        Folders.reset(new FolderSlot[Db.db.NumFolders]);
       }
 
       ~Archive()
       {
-        LzmaContext::Allocator()->Free(nullptr, Cache.OutBuffer);
         SzArEx_Free(&Db, LzmaContext::Allocator());
       }
 
@@ -203,16 +234,53 @@ namespace Formats::Archived
         return SzArEx_GetFileSize(&Db, idx);
       }
 
+      uint_t GetFileFolder(uint_t idx) const
+      {
+        return Db.FileToFolder[idx];
+      }
+
+      std::size_t GetFolderSize(uint_t folder) const
+      {
+        const auto size = SzAr_GetFolderUnpackSize(&Db.db, folder);
+        return static_cast<std::size_t>(std::min<UInt64>(size, ~std::size_t(0)));
+      }
+
       Binary::Container::Ptr GetFileData(uint_t idx) const
       {
-        // WARN: not thread-safe
-        size_t offset = 0;
-        size_t outSizeProcessed = 0;
-        CheckError(SzArEx_Extract(&Db, const_cast<ILookInStream*>(&Stream.s), idx, &Cache.BlockIndex, &Cache.OutBuffer,
-                                  &Cache.OutBufferSize, &offset, &outSizeProcessed, LzmaContext::Allocator(),
-                                  LzmaContext::Allocator()));
-        Require(outSizeProcessed == SzArEx_GetFileSize(&Db, idx));
-        return Binary::CreateContainer(Binary::View(Cache.OutBuffer + offset, outSizeProcessed));
+        const auto folder = GetFileFolder(idx);
+        Require(folder < Db.db.NumFolders);
+        const auto folderData = GetFolderData(folder);
+        const auto offset = Db.UnpackPositions[idx] - Db.UnpackPositions[Db.FolderToFile[folder]];
+        const auto size = GetFileSize(idx);
+        Require(offset + size <= folderData->Size());
+        if (SzBitWithVals_Check(&Db.CRCs, idx))
+        {
+          const auto* const start = static_cast<const uint8_t*>(folderData->Start()) + offset;
+          CheckError(CrcCalc(start, size) == Db.CRCs.Vals[idx] ? SZ_OK : SZ_ERROR_CRC);
+        }
+        return folderData->GetSubcontainer(offset, size);
+      }
+
+      Binary::Container::Ptr GetFolderData(uint_t folder) const
+      {
+        auto& slot = Folders[folder];
+        const std::lock_guard<std::mutex> lock(slot.Guard);
+        if (auto data = slot.Data.lock())
+        {
+          return data;
+        }
+        const auto size = SzAr_GetFolderUnpackSize(&Db.db, folder);
+        Dbg("Decoding folder {} ({} bytes)", folder, size);
+        Require(size == static_cast<std::size_t>(size));
+        std::unique_ptr<Binary::Dump> result(new Binary::Dump(static_cast<std::size_t>(size)));
+        // stream has a position, so each decoding uses its own one
+        const auto stream = std::make_unique<LookupStream>(Data);
+        CheckError(SzAr_DecodeFolder(&Db.db, folder, &stream->s, Db.dataPos, result->data(), result->size(),
+                                     LzmaContext::Allocator()));
+        auto data = Binary::CreateContainer(std::move(result));
+        slot.Data = data;
+        Recent.Add(data);
+        return data;
       }
 
     private:
@@ -222,28 +290,24 @@ namespace Formats::Archived
         Require(err == SZ_OK);
       }
 
-      struct UnpackCache
+      struct FolderSlot
       {
-        UInt32 BlockIndex;
-        Byte* OutBuffer;
-        size_t OutBufferSize;
-
-        UnpackCache()
-          : BlockIndex(~UInt32(0))
-          , OutBuffer(nullptr)
-          , OutBufferSize(0)
-        {}
+        std::mutex Guard;
+        std::weak_ptr<const Binary::Container> Data;
       };
 
     private:
-      LookupStream Stream;
+      const Binary::Data::Ptr Data;
       CSzArEx Db;
-      mutable UnpackCache Cache;
+      std::unique_ptr<FolderSlot[]> Folders;
+      mutable RecentFolders Recent;
     };
 
     class File : public Archived::File
     {
     public:
+      typedef std::shared_ptr<const File> Ptr;
+
       File(Archive::Ptr archive, uint_t idx)
         : Arch(std::move(archive))
         , Idx(idx)
@@ -269,6 +333,11 @@ namespace Formats::Archived
         return Arch->GetFileData(Idx);
       }
 
+      uint_t GetFolder() const
+      {
+        return Arch->GetFileFolder(Idx);
+      }
+
     private:
       const Archive::Ptr Arch;
       const uint_t Idx;
@@ -279,37 +348,103 @@ namespace Formats::Archived
     class Container : public Binary::BaseContainer<Archived::Container>
     {
     public:
-      Container(Binary::Container::Ptr data, std::vector<File::Ptr> files)
+      Container(Binary::Container::Ptr data, Archive::Ptr archive, const std::vector<File::Ptr>& files)
         : BaseContainer(std::move(data))
-        , Files(std::move(files))
+        , Arch(std::move(archive))
+        , FilesCount(static_cast<uint_t>(files.size()))
       {
-        for (const auto& file : Files)
+        for (const auto& file : files)
         {
           Lookup.insert(FilesMap::value_type(file->GetName(), file));
+          const auto folder = file->GetFolder();
+          if (Groups.empty() || Groups.back().Folder != folder)
+          {
+            Groups.push_back({folder, {}});
+          }
+          Groups.back().Files.push_back(file);
         }
       }
 
+      // Folders are decoded in parallel ahead of walker, limited by count and total unpacked size
       void ExploreFiles(const Container::Walker& walker) const override
       {
-        for (const auto& file : Files)
+        const std::size_t window = Groups.size() > 1 ? std::max(1u, std::thread::hardware_concurrency()) : 0;
+        std::deque<PrefetchedFolder> prefetched;
+        std::size_t prefetchedSize = 0;
+        for (std::size_t group = 0; group < Groups.size(); ++group)
         {
-          walker.OnFile(*file);
+          while (prefetched.size() < window && group + prefetched.size() < Groups.size())
+          {
+            const auto folder = Groups[group + prefetched.size()].Folder;
+            const auto size = Arch->GetFolderSize(folder);
+            // current folder is decoded regardless of its size
+            if (!prefetched.empty() && prefetchedSize + size > MAX_PREFETCH_SIZE)
+            {
+              break;
+            }
+            prefetchedSize += size;
+            prefetched.push_back({size, std::async(std::launch::async, [this, folder]() { return Prefetch(folder); })});
+          }
+          // keep folder alive while its files are processed
+          Binary::Container::Ptr folderData;
+          std::size_t folderSize = 0;
+          if (!prefetched.empty())
+          {
+            folderData = prefetched.front().Data.get();
+            folderSize = prefetched.front().Size;
+            prefetched.pop_front();
+          }
+          for (const auto& file : Groups[group].Files)
+          {
+            walker.OnFile(*file);
+          }
+          prefetchedSize -= folderSize;
         }
       }
 
-      File::Ptr FindFile(const String& name) const override
+      Archived::File::Ptr FindFile(const String& name) const override
       {
         const auto it = Lookup.find(name);
-        return it != Lookup.end() ? it->second : File::Ptr();
+        return it != Lookup.end() ? it->second : Archived::File::Ptr();
       }
 
       uint_t CountFiles() const override
       {
-        return static_cast<uint_t>(Files.size());
+        return FilesCount;
+      }
+
+    private:
+      Binary::Container::Ptr Prefetch(uint_t folder) const
+      {
+        try
+        {
+          return Arch->GetFolderData(folder);
+        }
+        catch (const std::exception&)
+        {
+          // error is reported on file access
+          return {};
+        }
       }
 
     private:
-      std::vector<File::Ptr> Files;
+      static const std::size_t MAX_PREFETCH_SIZE = 64 << 20;
+
+      struct PrefetchedFolder
+      {
+        std::size_t Size;
+        std::future<Binary::Container::Ptr> Data;
+      };
+
+      struct FolderFiles
+      {
+        uint_t Folder;
+        std::vector<File::Ptr> Files;
+      };
+
+      const Archive::Ptr Arch;
+      const uint_t FilesCount;
+      std::vector<FolderFiles> Groups;
       typedef std::map<String, File::Ptr> FilesMap;
       FilesMap Lookup;
     };
@@ -345,7 +480,7 @@ namespace Formats::Archived
 
       const SevenZip::Archive::Ptr archive = MakePtr<SevenZip::Archive>(archiveData);
       const auto totalFiles = archive->GetFilesCount();
-      std::vector<File::Ptr> files;
+      std::vector<SevenZip::File::Ptr> files;
       files.reserve(totalFiles);
       for (uint_t idx = 0; idx < totalFiles; ++idx)
       {
@@ -355,7 +490,7 @@ namespace Formats::Archived
         }
         files.emplace_back(MakePtr<SevenZip::File>(archive, idx));
       }
-      return MakePtr<SevenZip::Container>(std::move(archiveData), std::move(files));
+      return MakePtr<SevenZip::Container>(std::move(archiveData), archive, files);
     }
 
   private:
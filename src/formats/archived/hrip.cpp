@@ -154,7 +154,8 @@ namespace Formats::Archived
       {
         const std::size_t sourceSize = std::min(MAX_MODULE_SIZE, availSize - rawOffset);
         const Binary::Container::Ptr source = data.GetSubcontainer(rawOffset, sourceSize);
-        if (const Formats::Packed::Container::Ptr target = decoder->Decode(*source))
+        // files are decoded on demand
+        if (const Formats::Packed::Container::Ptr target = decoder->Probe(*source))
         {
           const String fileName = ExtractFileName(source->Start());
           const std::size_t fileSize = target->Size();
@@ -19,9 +19,15 @@
 #include <formats/packed/decoders.h>
 #include <formats/packed/rar_supp.h>
 // std includes
+#include <algorithm>
 #include <cstring>
 #include <deque>
+#include <list>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <set>
+#include <vector>
 
 namespace Formats::Archived
 {
@@ -70,6 +76,12 @@ namespace Formats::Archived
         : Stream(data)
       {}
 
+      BlocksIterator(Binary::View data, std::size_t offset)
+        : Stream(data)
+      {
+        Stream.Seek(offset);
+      }
+
       bool IsEof() const
       {
         const uint64_t curBlockSize = GetBlockSize();
@@ -152,6 +164,66 @@ namespace Formats::Archived
       Binary::DataInputStream Stream;
     };
 
+    // Decoded members LRU cache limited by total size
+    class MembersCache
+    {
+    public:
+      Binary::Container::Ptr Find(std::size_t offset)
+      {
+        const auto it = Index.find(offset);
+        if (it == Index.end())
+        {
+          return {};
+        }
+        Entries.splice(Entries.begin(), Entries, it->second);
+        return it->second->second;
+      }
+
+      void Add(std::size_t offset, Binary::Container::Ptr data)
+      {
+        const auto size = data->Size();
+        if (size > MAX_MEMBER_SIZE || Index.count(offset))
+        {
+          return;
+        }
+        Entries.emplace_front(offset, std::move(data));
+        Index.emplace(offset, Entries.begin());
+        Used += size;
+        while (Used > MAX_TOTAL_SIZE)
+        {
+          const auto& last = Entries.back();
+          Used -= last.second->Size();
+          Index.erase(last.first);
+          Entries.pop_back();
+        }
+      }
+
+    private:
+      static const std::size_t MAX_TOTAL_SIZE = 16 << 20;
+      static const std::size_t MAX_MEMBER_SIZE = MAX_TOTAL_SIZE / 4;
+
+      using Entry = std::pair<std::size_t, Binary::Container::Ptr>;
+      std::list<Entry> Entries;
+      std::map<std::size_t, std::list<Entry>::iterator> Index;
+      std::size_t Used = 0;
+    };
+
+    // Position in solid chain: stateful decoder that processed all the chained blocks before iterator
+    struct ChainCursor
+    {
+      ChainCursor(Binary::View data, std::size_t offset)
+        : Decoder(Packed::CreateRarDecoder())
+        , Iterator(data, offset)
+      {}
+
+      const Formats::Packed::Decoder::Ptr Decoder;
+      BlocksIterator Iterator;
+      uint_t LastUse = 0;
+    };
+
+    // Unpack state (window, PPM model, VM filters) cannot be copied, so checkpoints are kept as live decoders.
+    // Decoding of solid block resumes from the nearest cursor or from the nearest known non-solid chained block
+    // (that resets decoder's state). Every decoded block is cached, so out of order access mostly hits the cache.
     class ChainDecoder
     {
     public:
@@ -159,76 +231,131 @@ namespace Formats::Archived
 
       explicit ChainDecoder(Binary::Container::Ptr data)
         : Data(std::move(data))
-        , StatefulDecoder(Packed::CreateRarDecoder())
-        , ChainIterator(new BlocksIterator(*Data))
+        , PlainDecoder(Packed::CreateRarDecoder())
       {}
 
       Binary::Container::Ptr DecodeBlock(const FileBlock& block) const
       {
-        if (block.IsChained() && block.HasParent())
+        const std::lock_guard<std::mutex> lock(Guard);
+        if (auto cached = Members.Find(block.Offset))
         {
-          return AdvanceIterator(block.Offset, &ChainDecoder::ProcessBlock) ? DecodeSingleBlock(block)
-                                                                            : Binary::Container::Ptr();
+          Dbg(" Use cached block @{}", block.Offset);
+          return cached;
         }
-        else
+        if (!block.IsChained())
         {
-          return AdvanceIterator(block.Offset, &ChainDecoder::SkipBlock) ? DecodeSingleBlock(block)
-                                                                         : Binary::Container::Ptr();
+          // stored blocks do not affect decoder's state
+          return DecodeSingleBlock(*PlainDecoder, block);
         }
+        auto& cursor = block.HasParent() ? GetCursorBefore(block.Offset) : GetCursorAt(block.Offset);
+        cursor.LastUse = ++UseCounter;
+        return AdvanceCursor(cursor, block.Offset) ? DecodeSingleBlock(*cursor.Decoder, block)
+                                                   : Binary::Container::Ptr();
       }
 
     private:
-      bool AdvanceIterator(std::size_t offset, void (ChainDecoder::*BlockOp)(const FileBlock&) const) const
+      ChainCursor& GetCursorBefore(std::size_t offset) const
+      {
+        ChainCursor* best = nullptr;
+        for (const auto& cursor : Cursors)
+        {
+          const auto pos = cursor->Iterator.GetOffset();
+          if (pos <= offset && (!best || best->Iterator.GetOffset() < pos))
+          {
+            best = cursor.get();
+          }
+        }
+        const auto chainStart = ChainStarts.upper_bound(offset);
+        const auto nearestStart = chainStart != ChainStarts.begin() ? *std::prev(chainStart) : 0;
+        if (best && best->Iterator.GetOffset() >= nearestStart)
+        {
+          Dbg(" Resume from @{}", best->Iterator.GetOffset());
+          return *best;
+        }
+        return GetCursorAt(nearestStart);
+      }
+
+      ChainCursor& GetCursorAt(std::size_t offset) const
       {
-        if (ChainIterator->GetOffset() > offset)
+        for (const auto& cursor : Cursors)
         {
-          Dbg(" Reset caching iterator to beginning");
-          ChainIterator.reset(new BlocksIterator(*Data));
+          if (cursor->Iterator.GetOffset() == offset)
+          {
+            return *cursor;
+          }
         }
-        while (ChainIterator->GetOffset() <= offset && !ChainIterator->IsEof())
+        Dbg(" Start chain decoding from @{}", offset);
+        auto cursor = std::make_unique<ChainCursor>(*Data, offset);
+        if (Cursors.size() < MAX_CURSORS)
         {
-          const FileBlock& curBlock =
-              FileBlock(ChainIterator->GetFileHeader(), ChainIterator->GetOffset(), ChainIterator->GetBlockSize());
-          ChainIterator->Next();
+          Cursors.emplace_back(std::move(cursor));
+          return *Cursors.back();
+        }
+        auto& lru = *std::min_element(Cursors.begin(), Cursors.end(),
+                                      [](const auto& lh, const auto& rh) { return lh->LastUse < rh->LastUse; });
+        lru = std::move(cursor);
+        return *lru;
+      }
+
+      bool AdvanceCursor(ChainCursor& cursor, std::size_t offset) const
+      {
+        auto& iter = cursor.Iterator;
+        while (iter.GetOffset() <= offset && !iter.IsEof())
+        {
+          const FileBlock curBlock(iter.GetFileHeader(), iter.GetOffset(), iter.GetBlockSize());
+          iter.Next();
           if (curBlock.Header)
           {
+            if (curBlock.IsChained() && !curBlock.HasParent())
+            {
+              ChainStarts.insert(curBlock.Offset);
+            }
             if (curBlock.Offset == offset)
             {
               return true;
             }
             else if (curBlock.IsChained())
             {
-              (this->*BlockOp)(curBlock);
+              ProcessBlock(*cursor.Decoder, curBlock);
             }
           }
         }
         return false;
       }
 
-      Binary::Container::Ptr DecodeSingleBlock(const FileBlock& block) const
+      Binary::Container::Ptr DecodeSingleBlock(const Formats::Packed::Decoder& decoder, const FileBlock& block) const
       {
         Dbg(" Decoding block @{} (chained={}, hasParent={})", block.Offset, block.IsChained(), block.HasParent());
         const Binary::Container::Ptr blockContent = Data->GetSubcontainer(block.Offset, block.Size);
-        return StatefulDecoder->Decode(*blockContent);
+        Binary::Container::Ptr result = decoder.Decode(*blockContent);
+        if (result)
+        {
+          Members.Add(block.Offset, result);
+        }
+        return result;
       }
 
-      void ProcessBlock(const FileBlock& block) const
+      void ProcessBlock(const Formats::Packed::Decoder& decoder, const FileBlock& block) const
       {
         Dbg(" Decoding parent block @{} (chained={}, hasParent={})", block.Offset, block.IsChained(),
             block.HasParent());
         const Binary::Container::Ptr blockContent = Data->GetSubcontainer(block.Offset, block.Size);
-        StatefulDecoder->Decode(*blockContent);
-      }
-
-      void SkipBlock(const FileBlock& block) const
-      {
-        Dbg(" Skip block @{} (chained={}, hasParent={})", block.Offset, block.IsChained(), block.HasParent());
+        if (Binary::Container::Ptr result = decoder.Decode(*blockContent))
+        {
+          Members.Add(block.Offset, std::move(result));
+        }
       }
 
     private:
+      static const std::size_t MAX_CURSORS = 4;
+
       const Binary::Container::Ptr Data;
-      const Formats::Packed::Decoder::Ptr StatefulDecoder;
-      mutable std::unique_ptr<BlocksIterator> ChainIterator;
+      const Formats::Packed::Decoder::Ptr PlainDecoder;
+      mutable std::mutex Guard;
+      mutable std::vector<std::unique_ptr<ChainCursor>> Cursors;
+      mutable std::set<std::size_t> ChainStarts;
+      mutable MembersCache Members;
+      mutable uint_t UseCounter = 0;
     };
 
     class File : public Archived::File
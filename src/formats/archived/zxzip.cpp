@@ -44,7 +44,8 @@ namespace Formats::Archived
       for (std::size_t flatOffset = 0; rawOffset < archSize;)
       {
         const Binary::Container::Ptr rawData = data.GetSubcontainer(rawOffset, archSize - rawOffset);
-        const Formats::Packed::Container::Ptr fileData = decoder.Decode(*rawData);
+        // files are decoded on demand if supported
+        const Formats::Packed::Container::Ptr fileData = decoder.Probe(*rawData);
         if (!fileData)
         {
           break;
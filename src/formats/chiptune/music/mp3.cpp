@@ -117,6 +117,8 @@ namespace Formats::Chiptune
       }
 
       void AddFrame(const Frame& /*frame*/) override {}
+
+      void SetFramesLayout(const FramesLayout& /*layout*/) override {}
     };
 
     // as in minimp3
@@ -177,6 +179,24 @@ namespace Formats::Chiptune
         return GetChannels() == Channels::MONO;
       }
 
+      // Layer III only
+      std::size_t GetSideInfoSize() const
+      {
+        if (GetVersion() == Version::MPEG_1)
+        {
+          return GetIsMono() ? 17 : 32;
+        }
+        else
+        {
+          return GetIsMono() ? 9 : 17;
+        }
+      }
+
+      bool IsLayer3() const
+      {
+        return GetLayer() == Layer::III;
+      }
+
       uint_t GetBitrateKbps() const
       {
         static const uint_t HALFRATE[2][3][15] = {
@@ -283,9 +303,117 @@ namespace Formats::Chiptune
     static_assert(sizeof(FrameHeader) == 4, "Invalid layout");
     static const std::size_t MIN_FREEFORMAT_FRAME_SIZE = 16;
     static const std::size_t MAX_FREEFORMAT_FRAME_SIZE = 2304;
+    static const std::size_t MAX_FRAME_SIZE = 2881;
     static const uint_t MAX_SYNC_GAP_NOTLOST = 3;
     static const uint_t MAX_SYNC_LOSTS_COUNT = 3;
 
+    // http://gabriel.mp3-tech.org/mp3infotag.html
+    namespace XingTag
+    {
+      const uint32_t FRAMES_FLAG = 1;
+      const uint32_t BYTES_FLAG = 2;
+      const uint32_t TOC_FLAG = 4;
+      const std::size_t TOC_SIZE = 100;
+      const std::size_t TOC_SCALE = 256;
+
+      // Xing/Info tag frame is decoded as a silent one, so it's accounted in frames count
+      bool Parse(const FrameHeader& hdr, Binary::View frame, FramesLayout& layout, std::size_t& bytes)
+      {
+        if (!hdr.IsLayer3())
+        {
+          return false;
+        }
+        Binary::DataInputStream stream(frame);
+        stream.Skip(sizeof(hdr) + hdr.GetSideInfoSize());
+        const auto id = stream.ReadData(4);
+        if (0 != std::memcmp(id.Start(), "Xing", 4) && 0 != std::memcmp(id.Start(), "Info", 4))
+        {
+          return false;
+        }
+        const auto flags = stream.Read<be_uint32_t>();
+        if (0 == (flags & FRAMES_FLAG))
+        {
+          return false;
+        }
+        layout.FramesCount = stream.Read<be_uint32_t>() + 1;
+        bytes = (flags & BYTES_FLAG) ? std::size_t(stream.Read<be_uint32_t>()) : 0;
+        // offsets are in TOC_SCALE units of the frames data size, which is known only after verification
+        if (flags & TOC_FLAG)
+        {
+          const auto* toc = stream.ReadData(TOC_SIZE).As<uint8_t>();
+          layout.SeekTable.resize(TOC_SIZE);
+          for (std::size_t idx = 0; idx != TOC_SIZE; ++idx)
+          {
+            auto& point = layout.SeekTable[idx];
+            point.Frame = static_cast<uint_t>(uint64_t(layout.FramesCount) * idx / TOC_SIZE);
+            point.Offset = toc[idx];
+          }
+        }
+        return true;
+      }
+    }  // namespace XingTag
+
+    // http://www.codeproject.com/Articles/8295/MPEG-Audio-Frame-Header#VBRIHeader
+    namespace VbriTag
+    {
+      const std::size_t OFFSET = 4 + 32;
+
+      bool Parse(Binary::View frame, FramesLayout& layout, std::size_t& bytes)
+      {
+        Binary::DataInputStream stream(frame);
+        stream.Skip(OFFSET);
+        const auto id = stream.ReadData(4);
+        if (0 != std::memcmp(id.Start(), "VBRI", 4))
+        {
+          return false;
+        }
+        stream.Skip(2 + 2 + 2);  // version, delay, quality
+        bytes = stream.Read<be_uint32_t>();
+        layout.FramesCount = stream.Read<be_uint32_t>() + 1;
+        const uint_t entries = stream.Read<be_uint16_t>();
+        const uint_t scale = stream.Read<be_uint16_t>();
+        const uint_t entrySize = stream.Read<be_uint16_t>();
+        const uint_t framesPerEntry = stream.Read<be_uint16_t>();
+        if (entrySize > 4 || !framesPerEntry)
+        {
+          return true;
+        }
+        std::size_t offset = 0;
+        for (uint_t idx = 0; idx < entries; ++idx)
+        {
+          layout.SeekTable.push_back({idx * framesPerEntry, offset});
+          const auto* raw = stream.ReadData(entrySize).As<uint8_t>();
+          uint32_t chunk = 0;
+          for (uint_t byte = 0; byte < entrySize; ++byte)
+          {
+            chunk = (chunk << 8) | raw[byte];
+          }
+          offset += std::size_t(chunk) * scale;
+        }
+        return true;
+      }
+    }  // namespace VbriTag
+
+    // ID3v1 and APEv2 footer
+    std::size_t GetTrailingTagsSize(Binary::View data)
+    {
+      const auto* raw = data.As<uint8_t>();
+      const auto size = data.Size();
+      std::size_t result = 0;
+      if (size >= 128 && 0 == std::memcmp(raw + size - 128, "TAG", 3))
+      {
+        result += 128;
+      }
+      if (size >= result + 32 && 0 == std::memcmp(raw + size - result - 32, "APETAGEX", 8))
+      {
+        const auto* footer = raw + size - result - 32;
+        const std::size_t tagSize = ReadLE<uint32_t>(footer + 12);
+        const auto hasHeader = 0 != (ReadLE<uint32_t>(footer + 20) & 0x80000000);
+        result += tagSize + (hasHeader ? 32 : 0);
+      }
+      return std::min(result, size);
+    }
+
     class Format
     {
     public:
@@ -302,7 +430,12 @@ namespace Formats::Chiptune
         }
 
         uint_t syncLostsCount = 0;
-        for (auto freeFormatFrameSize = Synchronize(); Stream.GetRestSize() != 0;)
+        auto freeFormatFrameSize = Synchronize();
+        if (!freeFormatFrameSize)
+        {
+          ReadLayout(target);
+        }
+        while (Stream.GetRestSize() != 0)
         {
           const auto offset = Stream.GetPosition();
           if (const auto inFrame = ReadFrame(freeFormatFrameSize))
@@ -351,6 +484,139 @@ namespace Formats::Chiptune
       }
 
     private:
+      // Skips all the frames if their layout is known in advance
+      void ReadLayout(Builder& target)
+      {
+        const auto restSize = Stream.GetRestSize();
+        const auto* first = safe_ptr_cast<const FrameHeader*>(Stream.PeekRawData(sizeof(FrameHeader)));
+        if (!first || !first->IsValid() || first->IsFreeFormat())
+        {
+          return;
+        }
+        const Binary::View rest(Stream.PeekRawData(restSize), restSize);
+        const auto firstFrame = rest.SubView(0, first->GetFrameDataSize());
+        FramesLayout layout;
+        std::size_t size = 0;
+        bool relativeOffsets = false;
+        try
+        {
+          if (XingTag::Parse(*first, firstFrame, layout, size))
+          {
+            relativeOffsets = true;
+          }
+          else if (!VbriTag::Parse(firstFrame, layout, size) && !GuessConstantBitrate(*first, rest, layout))
+          {
+            return;
+          }
+        }
+        catch (const std::exception&)
+        {
+          return;
+        }
+        if (!size || !IsFramesEnd(*first, rest, size))
+        {
+          size = restSize - GetTrailingTagsSize(rest);
+          if (!IsFramesEnd(*first, rest, size))
+          {
+            return;
+          }
+        }
+        if (layout.SeekTable.empty())
+        {
+          // constant bitrate, so frames count is estimated as well
+          if (!layout.FramesCount)
+          {
+            const auto frameSize =
+                double(first->GetSamplesCount()) * first->GetBitrateKbps() * 125 / first->GetSamplerate();
+            layout.FramesCount = static_cast<uint_t>(size / frameSize + 0.5);
+          }
+        }
+        const auto offset = Stream.GetPosition();
+        for (auto& point : layout.SeekTable)
+        {
+          const auto pointOffset = relativeOffsets
+                                       ? static_cast<std::size_t>(uint64_t(size) * point.Offset / XingTag::TOC_SCALE)
+                                       : point.Offset;
+          point.Offset = offset + std::min(pointOffset, size);
+        }
+        layout.Location.Offset = offset;
+        layout.Location.Size = size;
+        layout.Properties.Samplerate = first->GetSamplerate();
+        layout.Properties.SamplesCount = first->GetSamplesCount();
+        layout.Properties.Mono = first->GetIsMono();
+        target.SetFramesLayout(layout);
+        Stream.Skip(size);
+      }
+
+      // Bitrate is checked for some frames at the start and around the middle of stream
+      static bool GuessConstantBitrate(const FrameHeader& first, Binary::View data, FramesLayout& layout)
+      {
+        const uint_t CHECKED_FRAMES = 8;
+        const auto bitrate = first.GetBitrateKbps();
+        for (std::size_t probe = 0; probe != 4; ++probe)
+        {
+          auto offset = data.Size() * probe / 4;
+          if (probe)
+          {
+            offset = FindFrame(first, data, offset);
+          }
+          for (uint_t frame = 0; frame != CHECKED_FRAMES; ++frame)
+          {
+            const auto* hdr = data.SubView(offset, sizeof(FrameHeader)).As<FrameHeader>();
+            if (!hdr || !hdr->IsValid() || !hdr->Matches(first) || hdr->GetBitrateKbps() != bitrate)
+            {
+              return false;
+            }
+            offset += hdr->GetFrameDataSize();
+          }
+        }
+        layout.FramesCount = 0;
+        return true;
+      }
+
+      // Finds first valid frame header matched to specified one and followed by another such a header
+      static std::size_t FindFrame(const FrameHeader& first, Binary::View data, std::size_t offset)
+      {
+        const auto* raw = data.As<uint8_t>();
+        for (const auto limit = std::min(data.Size(), offset + 2 * MAX_FRAME_SIZE);
+             offset + sizeof(FrameHeader) <= limit; ++offset)
+        {
+          const auto* hdr = safe_ptr_cast<const FrameHeader*>(raw + offset);
+          if (hdr->IsValid() && hdr->Matches(first) && !hdr->IsFreeFormat())
+          {
+            const auto* next = data.SubView(offset + hdr->GetFrameDataSize(), sizeof(FrameHeader)).As<FrameHeader>();
+            if (next && next->IsValid() && next->Matches(first))
+            {
+              return offset;
+            }
+          }
+        }
+        return data.Size();
+      }
+
+      // Checks if some frame ends exactly at specified offset
+      static bool IsFramesEnd(const FrameHeader& first, Binary::View data, std::size_t end)
+      {
+        if (end > data.Size() || end < sizeof(FrameHeader))
+        {
+          return false;
+        }
+        const auto* raw = data.As<uint8_t>();
+        const auto limit = end > MAX_FRAME_SIZE ? end - MAX_FRAME_SIZE : 0;
+        for (auto offset = end - sizeof(FrameHeader);; --offset)
+        {
+          const auto* hdr = safe_ptr_cast<const FrameHeader*>(raw + offset);
+          if (hdr->IsValid() && hdr->Matches(first) && !hdr->IsFreeFormat() && offset + hdr->GetFrameDataSize() == end)
+          {
+            return true;
+          }
+          else if (offset == limit)
+          {
+            return false;
+          }
+        }
+      }
+
       //@return free format frame size
       std::size_t Synchronize()
       {
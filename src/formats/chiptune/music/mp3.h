@@ -14,6 +14,8 @@
 #include "formats/chiptune/builder_meta.h"
 // library includes
 #include <formats/chiptune.h>
+// std includes
+#include <vector>
 
 namespace Formats
 {
@@ -40,6 +42,25 @@ namespace Formats
         SoundProperties Properties;
       };
 
+      //! Frames stream layout known without walking through all the frames (VBR info tag or constant bitrate)
+      struct FramesLayout
+      {
+        struct SeekPoint
+        {
+          uint_t Frame = 0;
+          //! Approximate offset relative to the whole data
+          std::size_t Offset = 0;
+        };
+
+        //! All the frames
+        Frame::DataLocation Location;
+        //! Of the first frame
+        Frame::SoundProperties Properties;
+        uint_t FramesCount = 0;
+        //! Coarse seek table, may be empty for constant bitrate streams
+        std::vector<SeekPoint> SeekTable;
+      };
+
       // Use simplified parsing due to thirdparty library used
       class Builder
       {
@@ -49,6 +70,9 @@ namespace Formats
         virtual MetaBuilder& GetMetaBuilder() = 0;
 
         virtual void AddFrame(const Frame& frame) = 0;
+
+        //! Called instead of AddFrame for all the frames described by layout
+        virtual void SetFramesLayout(const FramesLayout& layout) = 0;
       };
 
       Formats::Chiptune::Container::Ptr Parse(const Binary::Container& data, Builder& target);
@@ -51,6 +51,13 @@ namespace Formats
       //! @return Non-null object if data is successfully recognized and decoded
       //! @invariant Exactly Container::PackedSize first bytes is used from rawData
       virtual Container::Ptr Decode(const Binary::Container& rawData) const = 0;
+
+      //! @brief Check raw data decoding possibility without keeping unpacked data
+      //! @param rawData Data to be checked
+      //! @return Non-null object if data is successfully recognized and decoded. Its content may be decoded on first
+      //! access
+      //! @invariant Result has the same PackedSize and Size as Decode result
+      virtual Container::Ptr Probe(const Binary::Container& rawData) const;
     };
   }  // namespace Packed
 }  // namespace Formats
@@ -12,7 +12,7 @@
 
 // local includes
 #include "formats/packed/container.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -20,9 +20,6 @@
 // library includes
 #include <binary/format_factories.h>
 #include <formats/packed.h>
-// std includes
-#include <functional>
-#include <iterator>
 
 namespace Formats::Packed
 {
@@ -230,8 +227,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(Header.Data, container.GetSize() - offsetof(RawHeader, Data))
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(2 * Header.SizeOfPacked)
       {
         if (IsValid && !Stream.Eof())
         {
@@ -241,7 +237,7 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
       std::size_t GetUsedSize() const
@@ -253,9 +249,8 @@ namespace Formats::Packed
       bool DecodeData()
       {
         // The main concern is to decode data as much as possible, skipping defenitely invalid structure
-        Decoded.reserve(2 * Header.SizeOfPacked);
         // assume that first byte always exists due to header format
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           const uint_t data = Stream.GetByte();
           if (IsFinishMarker(data))
@@ -285,7 +280,7 @@ namespace Formats::Packed
         const uint_t shortLen = hiNibble + 3;
         const uint_t offset = 128 * loNibble + Stream.GetByte();
         const uint_t len = 0x0f == hiNibble ? shortLen + Stream.GetByte() : shortLen;
-        return CopyFromBack(offset, Decoded, len);
+        return Decoded.CopyFromBack(offset, len);
       }
 
       bool ProcessCommand(uint_t data)
@@ -293,33 +288,32 @@ namespace Formats::Packed
         const uint_t loNibble = data & 0x0f;
         const uint_t hiNibble = (data & 0xf0) >> 4;
 
-        std::back_insert_iterator<Binary::Dump> dst(Decoded);
         switch (loNibble)
         {
         case 0x01:  // long RLE
         {
           const uint_t len = 256 * hiNibble + Stream.GetByte() + 3;
-          std::fill_n(dst, len, Stream.GetByte());
+          Decoded.Fill(len, Stream.GetByte());
         }
           return true;
         // case 0x03://exit
         case 0x05:  // short copy
-          std::generate_n(dst, hiNibble + 1, std::bind(&ByteStream::GetByte, &Stream));
+          Decoded.Generate(hiNibble + 1, [this]() { return Stream.GetByte(); });
           return true;
         case 0x09:  // short RLE
-          std::fill_n(dst, hiNibble + 3, Stream.GetByte());
+          Decoded.Fill(hiNibble + 3, Stream.GetByte());
           return true;
         case 0x0b:  // 2 bytes
-          std::fill_n(dst, 2, static_cast<uint8_t>(hiNibble - 1));
+          Decoded.Fill(2, static_cast<uint8_t>(hiNibble - 1));
           return true;
         case 0x0d:  // long copy
         {
           const uint_t len = 256 * hiNibble + Stream.GetByte() + 1;
-          std::generate_n(dst, len, std::bind(&ByteStream::GetByte, &Stream));
+          Decoded.Generate(len, [this]() { return Stream.GetByte(); });
         }
           return true;
         default:  // short backref
-          return CopyFromBack((data & 0xf8) >> 3, Decoded, 2);
+          return Decoded.CopyFromBack((data & 0xf8) >> 3, 2);
         }
       }
 
@@ -327,8 +321,7 @@ namespace Formats::Packed
       bool IsValid;
       const RawHeader& Header;
       ByteStream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace CodeCruncher3
 
@@ -11,12 +11,14 @@
 // local includes
 #include "formats/packed/container.h"
 // common includes
+#include <contract.h>
 #include <make_ptr.h>
 // library includes
 #include <binary/container_base.h>
 #include <binary/container_factories.h>
 // std includes
 #include <cassert>
+#include <mutex>
 
 namespace Formats
 {
@@ -39,6 +41,61 @@ namespace Formats
       const std::size_t OriginalSize;
     };
 
+    class LazyContainer : public Container
+    {
+    public:
+      LazyContainer(std::size_t size, std::size_t origSize, std::function<Binary::Container::Ptr()> decode)
+        : UnpackedSize(size)
+        , OriginalSize(origSize)
+        , DecodeFunc(std::move(decode))
+      {}
+
+      const void* Start() const override
+      {
+        return GetDelegate().Start();
+      }
+
+      std::size_t Size() const override
+      {
+        return UnpackedSize;
+      }
+
+      Binary::Container::Ptr GetSubcontainer(std::size_t offset, std::size_t size) const override
+      {
+        return GetDelegate().GetSubcontainer(offset, size);
+      }
+
+      std::size_t PackedSize() const override
+      {
+        return OriginalSize;
+      }
+
+    private:
+      const Binary::Container& GetDelegate() const
+      {
+        std::call_once(Decoded, [this]() {
+          auto data = DecodeFunc();
+          // decoding is deterministic, so it's a logical error
+          Require(data && data->Size() == UnpackedSize);
+          Delegate = std::move(data);
+          DecodeFunc = {};
+        });
+        return *Delegate;
+      }
+
+    private:
+      const std::size_t UnpackedSize;
+      const std::size_t OriginalSize;
+      mutable std::once_flag Decoded;
+      mutable std::function<Binary::Container::Ptr()> DecodeFunc;
+      mutable Binary::Container::Ptr Delegate;
+    };
+
+    Container::Ptr Decoder::Probe(const Binary::Container& rawData) const
+    {
+      return Decode(rawData);
+    }
+
     Container::Ptr CreateContainer(Binary::Container::Ptr data, std::size_t origSize)
     {
       return origSize && data && data->Size() ? MakePtr<PackedContainer>(std::move(data), origSize) : Container::Ptr();
@@ -49,5 +106,11 @@ namespace Formats
       auto container = Binary::CreateContainer(std::move(data));
       return CreateContainer(std::move(container), origSize);
     }
+
+    Container::Ptr CreateLazyContainer(std::size_t size, std::size_t origSize,
+                                       std::function<Binary::Container::Ptr()> decode)
+    {
+      return size && origSize ? MakePtr<LazyContainer>(size, origSize, std::move(decode)) : Container::Ptr();
+    }
   }  // namespace Packed
 }  // namespace Formats
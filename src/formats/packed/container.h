@@ -15,6 +15,8 @@
 // library includes
 #include <binary/dump.h>
 #include <formats/packed.h>
+// std includes
+#include <functional>
 
 namespace Formats
 {
@@ -22,5 +24,12 @@ namespace Formats
   {
     Container::Ptr CreateContainer(Binary::Container::Ptr data, std::size_t origSize);
     Container::Ptr CreateContainer(std::unique_ptr<Binary::Dump> data, std::size_t origSize);
+
+    //! @brief Create container with deferred decoding
+    //! @param size Size of unpacked data
+    //! @param origSize Size of source data
+    //! @param decode Functor to perform real decoding, called at most once on first content access
+    Container::Ptr CreateLazyContainer(std::size_t size, std::size_t origSize,
+                                       std::function<Binary::Container::Ptr()> decode);
   }  // namespace Packed
 }  // namespace Formats
@@ -12,10 +12,9 @@
 
 // local includes
 #include "formats/packed/container.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
-#include <contract.h>
 #include <make_ptr.h>
 #include <pointers.h>
 // library includes
@@ -24,9 +23,6 @@
 #include <math/numeric.h>
 // std includes
 #include <algorithm>
-#include <functional>
-#include <iterator>
-#include <numeric>
 
 namespace Formats::Packed
 {
@@ -201,55 +197,8 @@ namespace Formats::Packed
 
     const std::size_t MIN_SIZE = sizeof(RawHeader);
 
-    // dsq bitstream decoder
-    class Bitstream
-    {
-    public:
-      Bitstream(const uint8_t* data, std::size_t size)
-        : Data(data)
-        , Pos(Data + size)
-        , Bits()
-        , Mask(0)
-      {}
-
-      uint_t GetBit()
-      {
-        if (!(Mask >>= 1))
-        {
-          Bits = GetByte();
-          Mask = 0x80;
-        }
-        return Bits & Mask ? 1 : 0;
-      }
-
-      uint_t GetBits(uint_t count)
-      {
-        uint_t result = 0;
-        while (count--)
-        {
-          result = 2 * result | GetBit();
-        }
-        return result;
-      }
-
-      uint8_t Get8Bits()
-      {
-        return static_cast<uint8_t>(GetBits(8));
-      }
-
-    private:
-      uint8_t GetByte()
-      {
-        Require(Pos > Data);
-        return *--Pos;
-      }
-
-    private:
-      const uint8_t* const Data;
-      const uint8_t* Pos;
-      uint_t Bits;
-      uint_t Mask;
-    };
+    // dsq bitstream: MSB->LSB, from the end to the start of packed data
+    using Bitstream = WideBitstream<true, true>;
 
     class Container
     {
@@ -316,8 +265,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(Header.Data, Header.SizeOfPacked)
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(Header.LastOfDepacked - Header.DepackedLimit)
       {
         if (IsValid)
         {
@@ -327,34 +275,30 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
     private:
       bool DecodeData()
       {
         const uint_t unpackedSize = Header.LastOfDepacked - Header.DepackedLimit;
-        Decoded.reserve(unpackedSize);
-        try
+        while (Decoded.Size() < unpackedSize)
         {
-          while (Decoded.size() < unpackedSize)
+          if (!Stream.GetBit())
           {
-            if (!Stream.GetBit())
-            {
-              Decoded.push_back(Stream.Get8Bits());
-            }
-            else if (!DecodeCmd())
-            {
-              return false;
-            }
+            Decoded.Add(Stream.Get8Bits());
+          }
+          else if (!DecodeCmd())
+          {
+            return false;
+          }
+          if (Stream.IsOverrun())
+          {
+            return false;
           }
-          std::reverse(Decoded.begin(), Decoded.end());
-          return true;
-        }
-        catch (const std::exception&)
-        {
-          return false;
         }
+        std::reverse(Decoded.Begin(), Decoded.End());
+        return true;
       }
 
       bool DecodeCmd()
@@ -366,7 +310,7 @@ namespace Formats::Packed
           return true;
         }
         const uint_t off = GetOffset();
-        return CopyFromBack(off, Decoded, len);
+        return Decoded.CopyFromBack(off, len);
       }
 
       uint_t GetLength()
@@ -420,15 +364,14 @@ namespace Formats::Packed
       void CopySingleBytes()
       {
         const uint_t count = 14 + Stream.GetBits(5);
-        std::generate_n(std::back_inserter(Decoded), count, std::bind(&Bitstream::Get8Bits, &Stream));
+        Decoded.Generate(count, [this]() { return Stream.Get8Bits(); });
       }
 
     private:
       bool IsValid;
       const RawHeader& Header;
       Bitstream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace DataSquieezer
 
@@ -12,7 +12,7 @@
 
 // local includes
 #include "formats/packed/container.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -23,8 +23,6 @@
 #include <math/numeric.h>
 // std includes
 #include <algorithm>
-#include <functional>
-#include <iterator>
 #include <numeric>
 
 namespace Formats::Packed
@@ -306,8 +304,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(Header.Data, Header.SizeOfPacked)
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(GetUnpackedSize())
       {
         if (IsValid && !Stream.Eof())
         {
@@ -317,26 +314,30 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
     private:
+      std::size_t GetUnpackedSize() const
+      {
+        return 1 + Header.LastOfDepacked - ((Header.DepackedLimit + 1) & 0xffff);
+      }
+
       bool DecodeData()
       {
-        const uint_t unpackedSize = 1 + Header.LastOfDepacked - ((Header.DepackedLimit + 1) & 0xffff);
-        Decoded.reserve(unpackedSize);
-        while (!Stream.Eof() && Decoded.size() < unpackedSize)
+        const std::size_t unpackedSize = GetUnpackedSize();
+        while (!Stream.Eof() && Decoded.Size() < unpackedSize)
         {
           if (!Stream.GetBit())
           {
-            Decoded.push_back(Stream.GetByte());
+            Decoded.Add(Stream.GetByte());
           }
           else if (!DecodeCmd())
           {
             return false;
           }
         }
-        std::reverse(Decoded.begin(), Decoded.end());
+        std::reverse(Decoded.Begin(), Decoded.End());
         return true;
       }
 
@@ -345,7 +346,7 @@ namespace Formats::Packed
         const uint_t len = GetLength();
         if (const uint_t off = GetOffset(len))
         {
-          return CopyFromBack(off, Decoded, len);
+          return Decoded.CopyFromBack(off, len);
         }
         return true;
       }
@@ -390,7 +391,7 @@ namespace Formats::Packed
             return 0x221 + Stream.GetBits(Header.WindowSize);
           }
           const uint_t size = 0x0a + Stream.GetBits(5);
-          std::generate_n(std::back_inserter(Decoded), size, std::bind(&Bitstream::GetByte, &Stream));
+          Decoded.Generate(size, [this]() { return Stream.GetByte(); });
           return 0;
         }
         //%0
@@ -407,8 +408,7 @@ namespace Formats::Packed
       bool IsValid;
       const RawHeader& Header;
       Bitstream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace ESVCruncher
 
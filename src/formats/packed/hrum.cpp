@@ -13,7 +13,7 @@
 // local includes
 #include "formats/packed/container.h"
 #include "formats/packed/hrust1_bitstream.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -209,8 +209,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(Header.BitStream, Header.SizeOfPacked - sizeof(Header.Padding7))
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(2 * Header.SizeOfPacked)
       {
         if (IsValid && !Stream.Eof())
         {
@@ -220,22 +219,21 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
     private:
       bool DecodeData()
       {
         // The main concern is to decode data as much as possible, skipping defenitely invalid structure
-        Decoded.reserve(2 * Header.SizeOfPacked);
         // put first byte
-        Decoded.push_back(Stream.GetByte());
+        Decoded.Add(Stream.GetByte());
         // assume that first byte always exists due to header format
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           if (Stream.GetBit())
           {
-            Decoded.push_back(Stream.GetByte());
+            Decoded.Add(Stream.GetByte());
             continue;
           }
           uint_t len = 1 + Stream.GetLen();
@@ -258,13 +256,13 @@ namespace Formats::Packed
             }
             offset = DecodeOffsetByLen(len);
           }
-          if (!CopyFromBack(-static_cast<int16_t>(offset), Decoded, len))
+          if (!Decoded.CopyFromBack(-static_cast<int16_t>(offset), len))
           {
             return false;
           }
         }
         // put remaining bytes
-        std::copy(Header.LastBytes, std::end(Header.LastBytes), std::back_inserter(Decoded));
+        Decoded.Copy(Header.LastBytes, sizeof(Header.LastBytes));
         return true;
       }
 
@@ -289,8 +287,7 @@ namespace Formats::Packed
       bool IsValid;
       const RawHeader& Header;
       Bitstream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace Hrum
 
@@ -13,7 +13,7 @@
 // local includes
 #include "formats/packed/container.h"
 #include "formats/packed/hrust1_bitstream.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -206,8 +206,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(Header.BitStream, container.GetUsedSize() - 12)
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(Header.DataSize)
       {
         if (IsValid && !Stream.Eof())
         {
@@ -217,23 +216,21 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
     private:
       bool DecodeData()
       {
-        Decoded.reserve(Header.DataSize);
-
         // put first byte
-        Decoded.push_back(Stream.GetByte());
+        Decoded.Add(Stream.GetByte());
         uint_t refBits = 2;
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           //%1 - put byte
           if (Stream.GetBit())
           {
-            Decoded.push_back(Stream.GetByte());
+            Decoded.Add(Stream.GetByte());
             continue;
           }
           uint_t len = Stream.GetLen();
@@ -288,7 +285,7 @@ namespace Formats::Packed
             {
               offset = static_cast<int16_t>(0xffe0 + Stream.GetBits(5));
             }
-            if (!CopyFromBack(-offset, Decoded, 2))
+            if (!Decoded.CopyFromBack(-offset, 2))
             {
               return false;
             }
@@ -313,7 +310,7 @@ namespace Formats::Packed
               const uint_t count = 2 * (6 + Stream.GetBits(4));
               for (uint_t bytes = 0; bytes < count; ++bytes)
               {
-                Decoded.push_back(Stream.GetByte());
+                Decoded.Add(Stream.GetByte());
               }
               continue;
             }
@@ -375,40 +372,38 @@ namespace Formats::Packed
             offset |= Stream.GetByte();
             offset = static_cast<int16_t>(offset & 0xffff);
           }
-          if (!CopyFromBack(-offset, Decoded, len))
+          if (!Decoded.CopyFromBack(-offset, len))
           {
             return false;
           }
         }
         // put remaining bytes
-        std::copy(Header.LastBytes, std::end(Header.LastBytes), std::back_inserter(Decoded));
+        Decoded.Copy(Header.LastBytes, sizeof(Header.LastBytes));
         return true;
       }
 
       bool CopyByteFromBack(int_t offset)
       {
         assert(offset <= 0);
-        const std::size_t size = Decoded.size();
+        const std::size_t size = Decoded.Size();
         if (uint_t(-offset) > size)
         {
           return false;  // invalid backreference
         }
-        const Binary::Dump::value_type val = Decoded[size + offset];
-        Decoded.push_back(val);
+        Decoded.Add(Decoded.Back(-offset));
         return true;
       }
 
       bool CopyBreaked(int_t offset)
       {
-        return CopyByteFromBack(offset) && (Decoded.push_back(Stream.GetByte()), true) && CopyByteFromBack(offset);
+        return CopyByteFromBack(offset) && (Decoded.Add(Stream.GetByte()), true) && CopyByteFromBack(offset);
       }
 
     private:
       bool IsValid;
       const RawHeader& Header;
       Hrust1Bitstream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace Hrust1
 
@@ -13,7 +13,7 @@
 // local includes
 #include "formats/packed/container.h"
 #include "formats/packed/hrust1_bitstream.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -25,8 +25,6 @@
 #include <math/numeric.h>
 // std includes
 #include <cstring>
-#include <functional>
-#include <iterator>
 #include <numeric>
 
 namespace Formats::Packed
@@ -203,37 +201,40 @@ namespace Formats::Packed
     class RawDataDecoder
     {
     public:
-      RawDataDecoder(const RawHeader& header, std::size_t rawSize)
+      RawDataDecoder(const RawHeader& header, std::size_t rawSize, bool storeData = true)
         : Header(header)
         , Stream(Header.BitStream, rawSize - offsetof(RawHeader, BitStream))
         , IsValid(!Stream.Eof())
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(rawSize * 2, storeData)
       {
         if (IsValid)
         {
-          Decoded.reserve(rawSize * 2);
           IsValid = DecodeData();
         }
       }
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
+      }
+
+      std::size_t GetResultSize() const
+      {
+        return IsValid ? Decoded.Size() : 0;
       }
 
     private:
       bool DecodeData()
       {
         // put first byte
-        Decoded.push_back(Header.FirstByte);
+        Decoded.Add(Header.FirstByte);
 
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           //%1,byte
           if (Stream.GetBit())
           {
-            Decoded.push_back(Stream.GetByte());
+            Decoded.Add(Stream.GetByte());
             continue;
           }
           uint_t len = Stream.GetLen();
@@ -253,7 +254,7 @@ namespace Formats::Packed
                 len = len * 256 | Stream.GetByte();
               }
               const int_t offset = Stream.GetDist();
-              if (!CopyFromBack(-offset, Decoded, len))
+              if (!Decoded.CopyFromBack(-offset, len))
               {
                 return false;
               }
@@ -262,7 +263,7 @@ namespace Formats::Packed
             {
               for (len = 2 * (Stream.GetBits(4) + 6); len; --len)
               {
-                Decoded.push_back(Stream.GetByte());
+                Decoded.Add(Stream.GetByte());
               }
             }
           }
@@ -275,13 +276,13 @@ namespace Formats::Packed
             const int_t offset = 1 == len
                                      ? static_cast<int16_t>(0xfff8 + Stream.GetBits(3))
                                      : (2 == len ? static_cast<int16_t>(0xff00 + Stream.GetByte()) : Stream.GetDist());
-            if (!CopyFromBack(-offset, Decoded, len))
+            if (!Decoded.CopyFromBack(-offset, len))
             {
               return false;
             }
           }
         }
-        std::copy(Header.LastBytes, std::end(Header.LastBytes), std::back_inserter(Decoded));
+        Decoded.Copy(Header.LastBytes, sizeof(Header.LastBytes));
         return true;
       }
 
@@ -289,8 +290,7 @@ namespace Formats::Packed
       const RawHeader& Header;
       Bitstream Stream;
       bool IsValid;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
 
     namespace Version1
@@ -389,6 +389,20 @@ namespace Formats::Packed
           return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
         }
 
+        static std::size_t Probe(const Container& container)
+        {
+          if (!container.FastCheck())
+          {
+            return 0;
+          }
+          const auto& header = container.GetHeader();
+          if (0 != (header.Flag & header.NO_COMPRESSION))
+          {
+            return header.DataSize;
+          }
+          return RawDataDecoder(header.Stream, header.PackedSize, false).GetResultSize();
+        }
+
       private:
         bool DecodeData()
         {
@@ -498,12 +512,27 @@ namespace Formats::Packed
         }
       }
 
+      std::size_t ProbeBlock(const Binary::Container& data)
+      {
+        if (data.Size() >= sizeof(RawHeader))
+        {
+          const RawHeader& block = *safe_ptr_cast<const RawHeader*>(data.Start());
+          return RawDataDecoder(block, data.Size(), false).GetResultSize();
+        }
+        else
+        {
+          return 0;
+        }
+      }
+
       class DataDecoder
       {
       public:
-        explicit DataDecoder(const Binary::Container& data)
+        explicit DataDecoder(const Binary::Container& data, bool storeData = true)
           : Data(data)
+          , StoreData(storeData)
           , UsedSize()
+          , ResultSize()
         {
           if (Container(data.Start(), data.Size()).FastCheck())
           {
@@ -521,6 +550,11 @@ namespace Formats::Packed
           return UsedSize;
         }
 
+        std::size_t GetResultSize() const
+        {
+          return ResultSize;
+        }
+
       private:
         void DecodeData()
         {
@@ -545,10 +579,23 @@ namespace Formats::Packed
               auto packedData = source.ReadContainer(packedSize);
               if (0 != (hdr->Flag & FormatHeader::STORED_BLOCK))
               {
+                ResultSize += packedSize;
                 target.AddBlock(std::move(packedData));
               }
+              else if (!StoreData)
+              {
+                if (const auto unpackedSize = ProbeBlock(*packedData))
+                {
+                  ResultSize += unpackedSize;
+                }
+                else
+                {
+                  break;
+                }
+              }
               else if (auto unpackedData = DecodeBlock(*packedData))
               {
+                ResultSize += unpackedData->Size();
                 target.AddBlock(std::move(unpackedData));
               }
               else
@@ -565,17 +612,19 @@ namespace Formats::Packed
               break;
             }
           }
-          Result = target.GetResult();
-          if (Result)
+          if (ResultSize)
           {
+            Result = StoreData ? target.GetResult() : Binary::Container::Ptr();
             UsedSize = source.GetPosition();
           }
         }
 
       private:
         const Binary::Container& Data;
+        const bool StoreData;
         Binary::Container::Ptr Result;
         std::size_t UsedSize;
+        std::size_t ResultSize;
       };
     }  // namespace Version3
   }    // namespace Hrust2
@@ -612,6 +661,25 @@ namespace Formats::Packed
       return CreateContainer(decoder.GetResult(), container.GetUsedSizeWithPadding());
     }
 
+    Container::Ptr Probe(const Binary::Container& rawData) const override
+    {
+      if (!Format->Match(rawData))
+      {
+        return Container::Ptr();
+      }
+      const Hrust2::Version1::Container container(rawData.Start(), rawData.Size());
+      const auto unpackedSize = Hrust2::Version1::DataDecoder::Probe(container);
+      if (!unpackedSize)
+      {
+        return Container::Ptr();
+      }
+      auto data = rawData.GetSubcontainer(0, rawData.Size());
+      return CreateLazyContainer(unpackedSize, container.GetUsedSizeWithPadding(), [data]() {
+        Hrust2::Version1::DataDecoder decoder(Hrust2::Version1::Container(data->Start(), data->Size()));
+        return Binary::CreateContainer(decoder.GetResult());
+      });
+    }
+
   private:
     const Binary::Format::Ptr Format;
   };
@@ -648,6 +716,30 @@ namespace Formats::Packed
       return CreateContainer(decoder.GetResult(), decoder.GetUsedSize());
     }
 
+    Container::Ptr Probe(const Binary::Container& rawData) const override
+    {
+      if (!Format->Match(rawData))
+      {
+        return Container::Ptr();
+      }
+      const Hrust2::Version3::Container container(rawData.Start(), rawData.Size());
+      if (!container.FastCheck())
+      {
+        return Container::Ptr();
+      }
+      const Hrust2::Version3::DataDecoder probe(rawData, false);
+      const auto usedSize = probe.GetUsedSize();
+      if (!usedSize)
+      {
+        return Container::Ptr();
+      }
+      auto data = rawData.GetSubcontainer(0, usedSize);
+      return CreateLazyContainer(probe.GetResultSize(), usedSize, [data]() {
+        Hrust2::Version3::DataDecoder decoder(*data);
+        return decoder.GetResult();
+      });
+    }
+
   private:
     const Binary::Format::Ptr Format;
   };
@@ -0,0 +1,266 @@
+/**
+ *
+ * @file
+ *
+ * @brief  LZ-family decoding helpers
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// local includes
+#include "formats/packed/pack_utils.h"
+// common includes
+#include <byteorder.h>
+#include <types.h>
+// library includes
+#include <binary/dump.h>
+// std includes
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+// Decoded data accumulator with amortized storage growth.
+// Expected size is only reserved, so candidates rejected early do not pay for filling it.
+// Every token allocates its whole size at once, so there's no per-byte bounds checking and resizing.
+// Window without storage only tracks size and validates backreferences, that's enough for decoding checks
+// since LZ decoders' control flow doesn't depend on decoded content.
+class OutputWindow
+{
+public:
+  explicit OutputWindow(std::size_t expectedSize, bool storeData = true)
+    : Buffer(storeData ? new Binary::Dump() : nullptr)
+    , Cursor()
+  {
+    if (Buffer)
+    {
+      Buffer->reserve(std::max<std::size_t>(expectedSize, MIN_CAPACITY));
+    }
+  }
+
+  std::size_t Size() const
+  {
+    return Cursor;
+  }
+
+  bool Empty() const
+  {
+    return Cursor == 0;
+  }
+
+  uint8_t* Begin()
+  {
+    return Buffer ? Buffer->data() : nullptr;
+  }
+
+  uint8_t* End()
+  {
+    return Buffer ? Buffer->data() + Cursor : nullptr;
+  }
+
+  void Add(uint8_t data)
+  {
+    if (auto* dst = Allocate(1))
+    {
+      *dst = data;
+    }
+  }
+
+  void Fill(std::size_t count, uint8_t data)
+  {
+    if (auto* dst = Allocate(count))
+    {
+      std::memset(dst, data, count);
+    }
+  }
+
+  void Copy(const uint8_t* data, std::size_t count)
+  {
+    if (auto* dst = Allocate(count))
+    {
+      std::memcpy(dst, data, count);
+    }
+  }
+
+  // generator is always called count times
+  template<class Generator>
+  void Generate(std::size_t count, Generator gen)
+  {
+    if (auto* dst = Allocate(count))
+    {
+      std::generate_n(dst, count, gen);
+    }
+    else
+    {
+      for (; count; --count)
+      {
+        gen();
+      }
+    }
+  }
+
+  // offset to back, zero offset produces zeroes
+  bool CopyFromBack(std::size_t offset, std::size_t count)
+  {
+    if (offset > Cursor)
+    {
+      return false;  // invalid backref
+    }
+    if (auto* dst = Allocate(count))
+    {
+      CopyOverlapped(dst, offset, count);
+    }
+    return true;
+  }
+
+  // byte at specified offset to back, offset should be in range [1..Size()]
+  uint8_t Back(std::size_t offset) const
+  {
+    return Buffer ? (*Buffer)[Cursor - offset] : 0;
+  }
+
+  // empty for window without storage
+  std::unique_ptr<Binary::Dump> CaptureResult()
+  {
+    Cursor = 0;
+    return std::move(Buffer);
+  }
+
+private:
+  uint8_t* Allocate(std::size_t count)
+  {
+    const std::size_t start = Cursor;
+    Cursor += count;
+    if (!Buffer)
+    {
+      return nullptr;
+    }
+    // growth is geometric after reserved capacity is exhausted
+    Buffer->resize(Cursor);
+    return Buffer->data() + start;
+  }
+
+private:
+  static const std::size_t MIN_CAPACITY = 256;
+  std::unique_ptr<Binary::Dump> Buffer;
+  std::size_t Cursor;
+};
+
+// Pure bitstream with 64-bit cache refilled by whole words where possible.
+// Bits are taken either from MSB or from LSB of each byte, bytes are taken either forward or backward.
+// Reading past the end produces zero bits and sets overrun flag, so it may be checked once per token.
+template<bool MsbFirst, bool Backward>
+class WideBitstream
+{
+public:
+  WideBitstream(const uint8_t* data, std::size_t size)
+    : Start(data)
+    , Finish(data + size)
+    , Cursor(Backward ? Finish : Start)
+  {}
+
+  bool IsOverrun() const
+  {
+    return Overrun;
+  }
+
+  uint_t GetBit()
+  {
+    return GetBits(1);
+  }
+
+  // count should be in range [0..32]
+  uint_t GetBits(uint_t count)
+  {
+    if (CacheBits < count)
+    {
+      Refill();
+      if (CacheBits < count)
+      {
+        // rest of cache is zero-filled
+        Overrun = true;
+        CacheBits = count;
+      }
+    }
+    uint_t result = 0;
+    if (count)
+    {
+      if (MsbFirst)
+      {
+        result = static_cast<uint_t>(Cache >> (64 - count));
+        Cache <<= count;
+      }
+      else
+      {
+        result = static_cast<uint_t>(Cache & ((uint64_t(1) << count) - 1));
+        Cache >>= count;
+      }
+      CacheBits -= count;
+    }
+    return result;
+  }
+
+  uint8_t Get8Bits()
+  {
+    return static_cast<uint8_t>(GetBits(8));
+  }
+
+private:
+  std::size_t GetRestBytes() const
+  {
+    return Backward ? Cursor - Start : Finish - Cursor;
+  }
+
+  // Keeps at least 56 bits in cache if possible.
+  // Whole word load may put more bits than accounted in CacheBits, but they are always equal to the next stream bits
+  void Refill()
+  {
+    if (GetRestBytes() >= sizeof(uint64_t))
+    {
+      const uint64_t word = LoadWord();
+      const uint_t bytes = (63 - CacheBits) / 8;
+      if (MsbFirst)
+      {
+        Cache |= word >> CacheBits;
+      }
+      else
+      {
+        Cache |= word << CacheBits;
+      }
+      Cursor = Backward ? Cursor - bytes : Cursor + bytes;
+      CacheBits += 8 * bytes;
+    }
+    else
+    {
+      for (; CacheBits <= 56 && GetRestBytes() != 0; CacheBits += 8)
+      {
+        const uint64_t byte = Backward ? *--Cursor : *Cursor++;
+        Cache |= MsbFirst ? byte << (56 - CacheBits) : byte << CacheBits;
+      }
+    }
+  }
+
+  // first byte of stream is placed to the cache side bits are taken from
+  uint64_t LoadWord() const
+  {
+    if (Backward)
+    {
+      const uint8_t* const word = Cursor - sizeof(uint64_t);
+      return MsbFirst ? ReadLE<uint64_t>(word) : ReadBE<uint64_t>(word);
+    }
+    else
+    {
+      return MsbFirst ? ReadBE<uint64_t>(Cursor) : ReadLE<uint64_t>(Cursor);
+    }
+  }
+
+private:
+  const uint8_t* const Start;
+  const uint8_t* const Finish;
+  const uint8_t* Cursor;
+  uint64_t Cache = 0;
+  uint_t CacheBits = 0;
+  bool Overrun = false;
+};
@@ -10,7 +10,7 @@
 
 // local includes
 #include "formats/packed/container.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -20,7 +20,6 @@
 #include <formats/packed.h>
 // std includes
 #include <algorithm>
-#include <iterator>
 
 namespace Formats::Packed
 {
@@ -288,8 +287,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(container.GetPackedData(), container.GetPackedSize())
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(2 * Stream.GetRestBytes())
       {
         if (IsValid && !Stream.Eof())
         {
@@ -299,14 +297,14 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
     private:
       bool DecodeData()
       {
         // assume that first byte always exists due to header format
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           const uint_t data = Stream.GetByte();
           if (!data)
@@ -317,7 +315,7 @@ namespace Formats::Packed
           {
             const std::size_t len = Version::GetLZLen(data);
             const std::size_t offset = Version::GetLZDistHi(data) + Stream.GetByte() + 2;
-            if (!CopyFromBack(offset, Decoded, len))
+            if (!Decoded.CopyFromBack(offset, len))
             {
               return false;
             }
@@ -325,14 +323,14 @@ namespace Formats::Packed
           else if (0 != (data & 64))
           {
             const std::size_t len = data - 0x3e + 1;
-            std::fill_n(std::back_inserter(Decoded), len, Stream.GetByte());
+            Decoded.Fill(len, Stream.GetByte());
           }
           else
           {
             std::size_t len = data;
             for (; len && !Stream.Eof(); --len)
             {
-              Decoded.push_back(Stream.GetByte());
+              Decoded.Add(Stream.GetByte());
             }
             if (len)
             {
@@ -340,7 +338,7 @@ namespace Formats::Packed
             }
           }
         }
-        Decoded.push_back(Header.LastDepackedByte);
+        Decoded.Add(Header.LastDepackedByte);
         return true;
       }
 
@@ -348,8 +346,7 @@ namespace Formats::Packed
       bool IsValid;
       const typename Version::RawHeader& Header;
       ByteStream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace LZH
 
@@ -12,7 +12,7 @@
 
 // local includes
 #include "formats/packed/container.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -22,7 +22,6 @@
 #include <formats/packed.h>
 // std includes
 #include <algorithm>
-#include <iterator>
 
 namespace Formats::Packed
 {
@@ -203,8 +202,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(Header.Data, Header.SizeOfPacked)
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(2 * Header.SizeOfPacked)
       {
         if (IsValid && !Stream.Eof())
         {
@@ -214,16 +212,15 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
     private:
       bool DecodeData()
       {
         // The main concern is to decode data as much as possible, skipping defenitely invalid structure
-        Decoded.reserve(2 * Header.SizeOfPacked);
         // assume that first byte always exists due to header format
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           const uint_t data = Stream.GetByte();
           if (0x80 == data)
@@ -243,7 +240,7 @@ namespace Formats::Packed
             assert(len);
             for (; len && !Stream.Eof(); --len)
             {
-              Decoded.push_back(Stream.GetByte());
+              Decoded.Add(Stream.GetByte());
             }
             if (len)
             {
@@ -254,13 +251,13 @@ namespace Formats::Packed
           {
             const std::size_t len = (data & 0x3f) + 3;
             const uint8_t filler = Stream.GetByte();
-            std::fill_n(std::back_inserter(Decoded), len, filler);
+            Decoded.Fill(len, filler);
           }
           else
           {
             const std::size_t len = ((data & 0xf0) >> 4) + 3;
             const uint_t offset = 256 * (data & 0x0f) + Stream.GetByte();
-            if (!CopyFromBack(offset, Decoded, len))
+            if (!Decoded.CopyFromBack(offset, len))
             {
               return false;
             }
@@ -268,7 +265,7 @@ namespace Formats::Packed
         }
         while (!Stream.Eof())
         {
-          Decoded.push_back(Stream.GetByte());
+          Decoded.Add(Stream.GetByte());
         }
         return true;
       }
@@ -277,8 +274,7 @@ namespace Formats::Packed
       bool IsValid;
       const RawHeader& Header;
       ByteStream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace LZS
 
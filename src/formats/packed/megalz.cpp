@@ -10,7 +10,7 @@
 
 // local includes
 #include "formats/packed/container.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <contract.h>
@@ -128,19 +128,17 @@ namespace Formats::Packed
       explicit DataDecoder(Binary::View data)
         : IsValid(data.Size() >= MIN_SIZE)
         , Stream(data.SubView(DEPACKER_SIZE))
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(data.Size() * 2)
       {
         if (IsValid)
         {
-          Decoded.reserve(data.Size() * 2);
           IsValid = DecodeData();
         }
       }
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
       std::size_t GetUsedSize() const
@@ -153,43 +151,43 @@ namespace Formats::Packed
       {
         try
         {
-          Decoded.push_back(Stream.GetByte());
-          while (Decoded.size() < MAX_DECODED_SIZE)
+          Decoded.Add(Stream.GetByte());
+          while (Decoded.Size() < MAX_DECODED_SIZE)
           {
             if (Stream.GetBit())
             {
-              Decoded.push_back(Stream.GetByte());
+              Decoded.Add(Stream.GetByte());
               continue;
             }
             const uint_t code = Stream.GetBits(2);
             if (code == 0)
             {
               //%0 00
-              Require(CopyFromBack(-static_cast<int16_t>(0xfff8 | Stream.GetBits(3)), Decoded, 1));
+              Require(Decoded.CopyFromBack(-static_cast<int16_t>(0xfff8 | Stream.GetBits(3)), 1));
             }
             else if (code == 1)
             {
               //%0 01
-              Require(CopyFromBack(-static_cast<int16_t>(0xff00 | Stream.GetByte()), Decoded, 2));
+              Require(Decoded.CopyFromBack(-static_cast<int16_t>(0xff00 | Stream.GetByte()), 2));
             }
             else if (code == 2)
             {
               //%0 10
-              Require(CopyFromBack(-Stream.GetDist(), Decoded, 3));
+              Require(Decoded.CopyFromBack(-Stream.GetDist(), 3));
             }
             else
             {
               const uint_t len = Stream.GetLen();
               if (len == 9)
               {
-                Require(Decoded.size() >= MIN_DECODED_SIZE);
+                Require(Decoded.Size() >= MIN_DECODED_SIZE);
                 return true;
               }
               else
               {
                 Require(len <= 7);
                 const uint_t bits = Stream.GetBits(len);
-                Require(CopyFromBack(-Stream.GetDist(), Decoded, 2 + (1 << len) + bits));
+                Require(Decoded.CopyFromBack(-Stream.GetDist(), 2 + (1 << len) + bits));
               }
             }
           }
@@ -202,8 +200,7 @@ namespace Formats::Packed
     private:
       bool IsValid;
       Bitstream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace MegaLZ
 
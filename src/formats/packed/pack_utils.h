@@ -79,6 +79,32 @@ void RecursiveCopy(ConstIterator srcBegin, ConstIterator srcEnd, Iterator dstBeg
   }
 }
 
+// LZ-style copy of count bytes from dst - offset to dst, source may overlap target
+// zero offset means no valid source, target is left as is
+inline void CopyOverlapped(uint8_t* dst, std::size_t offset, std::size_t count)
+{
+  if (offset >= count)
+  {
+    std::memcpy(dst, dst - offset, count);
+  }
+  else if (offset == 1)
+  {
+    std::memset(dst, dst[-1], count);
+  }
+  else if (offset != 0)
+  {
+    // every copied period doubles the contiguous source block
+    while (offset < count)
+    {
+      std::memcpy(dst, dst - offset, offset);
+      dst += offset;
+      count -= offset;
+      offset += offset;
+    }
+    std::memcpy(dst, dst - offset, count);
+  }
+}
+
 // offset to back
 inline bool CopyFromBack(std::size_t offset, Binary::Dump& dst, std::size_t count)
 {
@@ -88,10 +114,7 @@ inline bool CopyFromBack(std::size_t offset, Binary::Dump& dst, std::size_t coun
     return false;  // invalid backref
   }
   dst.resize(size + count);
-  const Binary::Dump::iterator dstStart = dst.begin() + size;
-  const Binary::Dump::const_iterator srcStart = dstStart - offset;
-  const Binary::Dump::const_iterator srcEnd = srcStart + count;
-  RecursiveCopy(srcStart, srcEnd, dstStart);
+  CopyOverlapped(dst.data() + size, offset, count);
   return true;
 }
 
@@ -13,7 +13,7 @@
 // local includes
 #include "formats/packed/container.h"
 #include "formats/packed/hrust1_bitstream.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <make_ptr.h>
@@ -178,8 +178,7 @@ namespace Formats::Packed
       explicit DataDecoder(const Container& container)
         : IsValid(container.FastCheck())
         , Stream(container.GetPackedData(), container.GetPackedSize())
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(Stream.GetRestBytes() * 2)
       {
         if (IsValid && !Stream.Eof())
         {
@@ -189,20 +188,18 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
     private:
       bool DecodeData()
       {
-        Decoded.reserve(Stream.GetRestBytes() * 2);
-
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           //%0 - put byte
           if (!Stream.GetBit())
           {
-            Decoded.push_back(Stream.GetByte());
+            Decoded.Add(Stream.GetByte());
             continue;
           }
           uint_t code = Stream.GetBits(2);
@@ -217,7 +214,7 @@ namespace Formats::Packed
           if (2 == code)
           {
             const uint_t offset = Stream.GetByte() + 1;
-            if (!CopyFromBack(offset, Decoded, 2))
+            if (!Decoded.CopyFromBack(offset, 2))
             {
               return false;
             }
@@ -249,7 +246,7 @@ namespace Formats::Packed
             }
           }
           const uint_t offset = GetOffset();
-          if (!CopyFromBack(offset, Decoded, len))
+          if (!Decoded.CopyFromBack(offset, len))
           {
             return false;
           }
@@ -286,8 +283,7 @@ namespace Formats::Packed
     private:
       bool IsValid;
       Hrust1Bitstream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace Trush
 
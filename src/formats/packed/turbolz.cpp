@@ -10,7 +10,7 @@
 
 // local includes
 #include "formats/packed/container.h"
-#include "formats/packed/pack_utils.h"
+#include "formats/packed/lz_utils.h"
 // common includes
 #include <byteorder.h>
 #include <contract.h>
@@ -22,7 +22,6 @@
 // std includes
 #include <algorithm>
 #include <array>
-#include <iterator>
 
 namespace Formats::Packed
 {
@@ -309,8 +308,7 @@ namespace Formats::Packed
         : IsValid(container.FastCheck())
         , Header(container.GetHeader())
         , Stream(container.GetPackedData(), container.GetPackedDataSize())
-        , Result(new Binary::Dump())
-        , Decoded(*Result)
+        , Decoded(2 * Stream.GetRestBytes())
       {
         if (IsValid && !Stream.Eof())
         {
@@ -321,7 +319,7 @@ namespace Formats::Packed
 
       std::unique_ptr<Binary::Dump> GetResult()
       {
-        return IsValid ? std::move(Result) : std::unique_ptr<Binary::Dump>();
+        return IsValid ? Decoded.CaptureResult() : std::unique_ptr<Binary::Dump>();
       }
 
       std::size_t GetUsedSize() const
@@ -333,13 +331,13 @@ namespace Formats::Packed
       template<class KeyFunc>
       bool DecodeData(KeyFunc& keyFunctor)
       {
-        while (!Stream.Eof() && Decoded.size() < MAX_DECODED_SIZE)
+        while (!Stream.Eof() && Decoded.Size() < MAX_DECODED_SIZE)
         {
           const uint_t token = Stream.GetByte();
           if (!token)
           {
             //%00000000 - exit
-            Decoded.push_back(Header.LastByte);
+            Decoded.Add(Header.LastByte);
             Simple::KeyFunc noDecode;
             CopyNonPacked(Stream.GetRestBytes(), noDecode);
             return true;
@@ -350,7 +348,7 @@ namespace Formats::Packed
             //%111YYYY1 yyyyyyyy nnnnnnnn
             const uint_t offset = 256 * ((token & 30) >> 1) + Stream.GetByte();
             const uint_t len = (0xe0 == (token & 0xe0)) ? Stream.GetByte() : 3 + (token >> 5);
-            if (!CopyFromBack(offset + 1, Decoded, len))
+            if (!Decoded.CopyFromBack(offset + 1, len))
             {
               return false;
             }
@@ -365,7 +363,7 @@ namespace Formats::Packed
             uint8_t incMarker = 63 + 3;
             for (uint_t len = initCount + 3; len;)
             {
-              std::fill_n(std::back_inserter(Decoded), len, data);
+              Decoded.Fill(len, data);
               if (len != incMarker)
               {
                 break;
@@ -409,7 +407,7 @@ namespace Formats::Packed
         {
           const uint8_t data = Stream.GetByte();
           const uint8_t key = keyFunctor();
-          Decoded.push_back(data ^ key);
+          Decoded.Add(data ^ key);
         }
         return len == 0;
       }
@@ -418,8 +416,7 @@ namespace Formats::Packed
       bool IsValid;
       const typename Version::RawHeader& Header;
       ByteStream Stream;
-      std::unique_ptr<Binary::Dump> Result;
-      Binary::Dump& Decoded;
+      OutputWindow Decoded;
     };
   }  // namespace TurboLZ
 
@@ -59,9 +59,157 @@ namespace
       Start += Time::Microseconds::FromRatio(frame.Properties.SamplesCount, frame.Properties.Samplerate);
     }
 
+    void SetFramesLayout(const Mp3::FramesLayout& layout) override
+    {
+      std::cout << Strings::Format(
+          "Frames: @{0}(0x{0:08x})/{1} bytes {2}hz {3} samples x {4} frames, {5} seek points\n", layout.Location.Offset,
+          layout.Location.Size, layout.Properties.Samplerate, layout.Properties.SamplesCount, layout.FramesCount,
+          layout.SeekTable.size());
+      Start += Time::Microseconds::FromRatio(uint64_t(layout.Properties.SamplesCount) * layout.FramesCount,
+                                             layout.Properties.Samplerate);
+    }
+
   private:
     Time::AtMicrosecond Start;
   };
+
+  void Require(bool condition, const char* what)
+  {
+    if (!condition)
+    {
+      throw std::runtime_error(std::string("Failed: ") + what);
+    }
+  }
+
+  class LayoutBuilder : public Mp3::Builder
+  {
+  public:
+    MetaBuilder& GetMetaBuilder() override
+    {
+      return GetStubMetaBuilder();
+    }
+
+    void AddFrame(const Mp3::Frame& /*frame*/) override
+    {
+      ++Frames;
+    }
+
+    void SetFramesLayout(const Mp3::FramesLayout& layout) override
+    {
+      Layout = layout;
+      ++Layouts;
+    }
+
+    uint_t Frames = 0;
+    uint_t Layouts = 0;
+    Mp3::FramesLayout Layout;
+  };
+
+  // MPEG1 LayerIII 128kbps 44100Hz stereo
+  const std::size_t FRAME_SIZE = 417;
+  const std::size_t TAG_OFFSET = 4 + 32;
+  const std::size_t ID3_SIZE = 20;
+
+  std::unique_ptr<Binary::Dump> MakeStream(uint_t frames)
+  {
+    std::unique_ptr<Binary::Dump> result(new Binary::Dump(ID3_SIZE + FRAME_SIZE * frames));
+    auto& data = *result;
+    const uint8_t id3[] = {'I', 'D', '3', 3, 0, 0, 0, 0, 0, ID3_SIZE - 10};
+    std::copy(std::begin(id3), std::end(id3), data.begin());
+    for (uint_t frame = 0; frame != frames; ++frame)
+    {
+      const uint8_t hdr[] = {0xff, 0xfb, 0x90, 0x00};
+      std::copy(std::begin(hdr), std::end(hdr), data.begin() + ID3_SIZE + FRAME_SIZE * frame);
+    }
+    return result;
+  }
+
+  void WriteBE(Binary::Dump& data, std::size_t offset, uint_t size, uint32_t value)
+  {
+    while (size--)
+    {
+      data[offset + size] = static_cast<uint8_t>(value);
+      value >>= 8;
+    }
+  }
+
+  LayoutBuilder ParseLayout(std::unique_ptr<Binary::Dump> data)
+  {
+    const auto size = data->size();
+    const auto container = Binary::CreateContainer(std::move(data));
+    LayoutBuilder builder;
+    const auto result = Mp3::Parse(*container, builder);
+    Require(result && result->Size() == size, "Parsed size");
+    Require(builder.Layouts == 1 && builder.Frames == 0, "Layout instead of frames");
+    Require(builder.Layout.Location.Offset == ID3_SIZE, "Frames start");
+    Require(builder.Layout.Location.Size == size - ID3_SIZE, "Frames size");
+    return builder;
+  }
+
+  // Xing tag without bytes field, linear TOC
+  void TestXing()
+  {
+    const uint_t FRAMES = 100;
+    auto data = MakeStream(FRAMES);
+    const auto tag = ID3_SIZE + TAG_OFFSET;
+    std::memcpy(data->data() + tag, "Xing", 4);
+    WriteBE(*data, tag + 4, 4, 1 | 4);
+    WriteBE(*data, tag + 8, 4, FRAMES - 1);
+    for (uint_t idx = 0; idx != 100; ++idx)
+    {
+      (*data)[tag + 12 + idx] = static_cast<uint8_t>(idx * 256 / 100);
+    }
+    const auto& layout = ParseLayout(std::move(data)).Layout;
+    Require(layout.FramesCount == FRAMES, "Xing frames count");
+    Require(layout.SeekTable.size() == 100, "Xing TOC size");
+    const auto framesSize = FRAMES * FRAME_SIZE;
+    for (uint_t idx = 0; idx != 100; ++idx)
+    {
+      const auto& point = layout.SeekTable[idx];
+      const auto expected = ID3_SIZE + framesSize * idx / 100;
+      Require(point.Frame == idx, "Xing TOC frame");
+      Require(point.Offset + FRAME_SIZE > expected && point.Offset < expected + FRAME_SIZE, "Xing TOC offset");
+    }
+    std::cout << "Xing: passed" << std::endl;
+  }
+
+  // VBRI tag with 2-bytes entries for each 10 frames
+  void TestVbri()
+  {
+    const uint_t FRAMES = 100;
+    auto data = MakeStream(FRAMES);
+    const auto tag = ID3_SIZE + TAG_OFFSET;
+    std::memcpy(data->data() + tag, "VBRI", 4);
+    WriteBE(*data, tag + 10, 4, FRAMES * FRAME_SIZE);
+    WriteBE(*data, tag + 14, 4, FRAMES - 1);
+    WriteBE(*data, tag + 18, 2, 10);
+    WriteBE(*data, tag + 20, 2, 1);
+    WriteBE(*data, tag + 22, 2, 2);
+    WriteBE(*data, tag + 24, 2, 10);
+    for (uint_t idx = 0; idx != 10; ++idx)
+    {
+      WriteBE(*data, tag + 26 + idx * 2, 2, 10 * FRAME_SIZE);
+    }
+    const auto& layout = ParseLayout(std::move(data)).Layout;
+    Require(layout.FramesCount == FRAMES, "VBRI frames count");
+    Require(layout.SeekTable.size() == 10, "VBRI table size");
+    for (uint_t idx = 0; idx != 10; ++idx)
+    {
+      const auto& point = layout.SeekTable[idx];
+      Require(point.Frame == idx * 10, "VBRI table frame");
+      Require(point.Offset == ID3_SIZE + idx * 10 * FRAME_SIZE, "VBRI table offset");
+    }
+    std::cout << "VBRI: passed" << std::endl;
+  }
+
+  void TestConstantBitrate()
+  {
+    const uint_t FRAMES = 100;
+    const auto& layout = ParseLayout(MakeStream(FRAMES)).Layout;
+    Require(layout.FramesCount == FRAMES, "CBR frames count");
+    Require(layout.SeekTable.empty(), "CBR seek table");
+    std::cout << "CBR: passed" << std::endl;
+  }
 }  // namespace
 
 int main(int argc, char* argv[])
@@ -70,6 +218,9 @@ int main(int argc, char* argv[])
   {
     if (argc < 2)
     {
+      TestXing();
+      TestVbri();
+      TestConstantBitrate();
       return 0;
     }
     std::unique_ptr<Binary::Dump> rawData(new Binary::Dump());
@@ -72,6 +72,30 @@ namespace
     files.push_back("p5_solid.bin");
     Test::TestArchived(*archived, "etalon.bin", "test_v2solid5.rar", files);
   }
+
+  void TestSolidRandomAccess(const Binary::Dump& etalon)
+  {
+    std::cout << "Testing solid archive random access" << std::endl;
+    Binary::Dump rar;
+    Test::OpenFile("test_v2solid5.rar", rar);
+    const Formats::Archived::Decoder::Ptr archived = Formats::Archived::CreateRarDecoder();
+    const Formats::Archived::Container::Ptr container = archived->Decode(*Binary::CreateContainer(rar));
+    if (!container)
+    {
+      throw std::runtime_error("Failed to decode");
+    }
+    for (const auto* name : {"p5_solid.bin", "p5.bin", "p5_solid.bin"})
+    {
+      std::cout << " checking " << name << std::endl;
+      const Formats::Archived::File::Ptr file = container->FindFile(name);
+      const Binary::Container::Ptr unpacked = file ? file->GetData() : Binary::Container::Ptr();
+      if (!unpacked || unpacked->Size() != etalon.size()
+          || 0 != std::memcmp(etalon.data(), unpacked->Start(), etalon.size()))
+      {
+        throw std::runtime_error("Invalid decode");
+      }
+    }
+  }
 }  // namespace
 
 int main()
@@ -83,6 +107,7 @@ int main()
   {
     TestBase(etalon);
     TestSolid(etalon);
+    TestSolidRandomAccess(etalon);
   }
   catch (const std::exception& e)
   {
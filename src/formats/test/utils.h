@@ -94,6 +94,20 @@ namespace Test
           throw std::runtime_error("Invalid used data size");
         }
         std::cout << "  passed positive" << std::endl;
+        // stateful decoders (e.g. solid rar chains) cannot be rerun
+        if (checkCorrupted)
+        {
+          const Formats::Packed::Container::Ptr probed = decoder.Probe(*testdata);
+          if (!probed || probed->Size() != unpacked->Size() || probed->PackedSize() != unpacked->PackedSize())
+          {
+            throw std::runtime_error("Invalid probe");
+          }
+          if (0 != std::memcmp(probed->Start(), unpacked->Start(), unpacked->Size()))
+          {
+            throw std::runtime_error("Invalid probed data");
+          }
+          std::cout << "  passed probe" << std::endl;
+        }
       }
       else
       {
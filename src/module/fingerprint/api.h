@@ -0,0 +1,55 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Modules similarity fingerprints interface
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// common includes
+#include <types.h>
+// library includes
+#include <module/holder.h>
+// std includes
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Module
+{
+  namespace Fingerprint
+  {
+    // MinHash over shingles of chip registers stream
+    const std::size_t SIGNATURE_SIZE = 64;
+    typedef std::array<uint32_t, SIGNATURE_SIZE> Signature;
+
+    // in percents
+    const uint_t DEFAULT_SIMILARITY = 70;
+
+    //! @return false if module does not provide registers stream or it's too short
+    //! @throw Error in case of internal problems
+    bool Calculate(const Holder& holder, Signature& result);
+
+    //! @return estimated similarity in percents
+    uint_t GetSimilarity(const Signature& lh, const Signature& rh);
+
+    // Locality-sensitive hashing index, so only signatures with matched bands are compared
+    class Index
+    {
+    public:
+      typedef std::unique_ptr<Index> Ptr;
+      virtual ~Index() = default;
+
+      virtual void Add(std::size_t id, const Signature& signature) = 0;
+
+      //! @return groups of at least two ids transitively similar to each other, ordered by addition
+      virtual std::vector<std::vector<std::size_t>> FindClusters(uint_t similarity) const = 0;
+
+      static Ptr Create();
+    };
+  }  // namespace Fingerprint
+}  // namespace Module
@@ -0,0 +1,264 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Modules similarity fingerprints implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+// local includes
+#include "api.h"
+// library includes
+#include <devices/aym.h>
+#include <module/players/aym/aym_base.h>
+#include <sound/loop.h>
+// std includes
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+namespace Module::Fingerprint
+{
+  namespace
+  {
+    // only the beginning of tune is analyzed
+    const Time::Seconds DURATION(60);
+    // consecutive distinct register states combined into single shingle
+    const std::size_t SHINGLE_FRAMES = 4;
+    // too short streams are not descriptive enough
+    const std::size_t MIN_SHINGLES = 16;
+    // 16 bands of 4 rows gives ~50% similarity as a candidates threshold
+    const std::size_t BANDS = 16;
+    const std::size_t BAND_ROWS = SIGNATURE_SIZE / BANDS;
+    static_assert(BANDS * BAND_ROWS == SIGNATURE_SIZE, "Invalid bands layout");
+
+    // splitmix64 finalizer
+    uint64_t Mix(uint64_t val)
+    {
+      val = (val ^ (val >> 30)) * 0xbf58476d1ce4e5b9ull;
+      val = (val ^ (val >> 27)) * 0x94d049bb133111ebull;
+      return val ^ (val >> 31);
+    }
+
+    class ShinglesCollector
+    {
+    public:
+      ShinglesCollector()
+      {
+        State.fill(0);
+        Recent.fill(0);
+        MinHashes.fill(~uint32_t(0));
+      }
+
+      void Add(const Devices::AYM::Registers& data)
+      {
+        for (Devices::AYM::Registers::IndicesIterator it(data); it; ++it)
+        {
+          State[*it] = data[*it];
+        }
+        AddFrame(GetFrameHash());
+      }
+
+      bool GetSignature(Signature& result) const
+      {
+        if (Shingles < MIN_SHINGLES)
+        {
+          return false;
+        }
+        result = MinHashes;
+        return true;
+      }
+
+    private:
+      // audible state only, so different ways to produce the same sound are not distinguished
+      uint64_t GetFrameHash() const
+      {
+        using Devices::AYM::Registers;
+        const uint_t mixer = State[Registers::MIXER];
+        bool noise = false;
+        bool envelope = false;
+        uint64_t hash = 0;
+        for (uint_t chan = 0; chan != 3; ++chan)
+        {
+          const uint_t vol = State[Registers::VOLA + chan] & (Registers::MASK_VOL | Registers::MASK_ENV);
+          const bool hasTone = 0 == (mixer & (Registers::MASK_TONEA << chan));
+          const bool hasNoise = 0 == (mixer & (Registers::MASK_NOISEA << chan));
+          uint64_t channel = 0;
+          if (vol && (hasTone || hasNoise))
+          {
+            const uint_t tone =
+                hasTone ? 256 * (State[Registers::TONEA_H + chan * 2] & 0x0f) + State[Registers::TONEA_L + chan * 2]
+                        : 0;
+            channel = (uint64_t(tone) << 8) | (vol << 1) | hasNoise;
+            noise |= hasNoise;
+            envelope |= 0 != (vol & Registers::MASK_ENV);
+          }
+          hash = Mix(hash ^ channel);
+        }
+        if (noise)
+        {
+          hash = Mix(hash ^ (State[Registers::TONEN] & 0x1f));
+        }
+        if (envelope)
+        {
+          const uint_t period = 256 * State[Registers::TONEE_H] + State[Registers::TONEE_L];
+          hash = Mix(hash ^ ((uint64_t(period) << 4) | (State[Registers::ENV] & 0x0f)));
+        }
+        return hash;
+      }
+
+      // repeated states are collapsed to make shingles independent of tempo
+      void AddFrame(uint64_t hash)
+      {
+        if (Frames && Recent[(Frames - 1) % SHINGLE_FRAMES] == hash)
+        {
+          return;
+        }
+        Recent[Frames++ % SHINGLE_FRAMES] = hash;
+        if (Frames < SHINGLE_FRAMES)
+        {
+          return;
+        }
+        uint64_t shingle = 0;
+        for (std::size_t idx = 0; idx != SHINGLE_FRAMES; ++idx)
+        {
+          shingle = Mix(shingle ^ Recent[(Frames + idx) % SHINGLE_FRAMES]);
+        }
+        for (std::size_t idx = 0; idx != SIGNATURE_SIZE; ++idx)
+        {
+          const auto val = static_cast<uint32_t>(Mix(shingle + idx * 0x9e3779b97f4a7c15ull) >> 32);
+          MinHashes[idx] = std::min(MinHashes[idx], val);
+        }
+        ++Shingles;
+      }
+
+    private:
+      std::array<uint8_t, Devices::AYM::Registers::TOTAL> State;
+      std::array<uint64_t, SHINGLE_FRAMES> Recent;
+      std::size_t Frames = 0;
+      std::size_t Shingles = 0;
+      Signature MinHashes;
+    };
+
+    class DisjointSets
+    {
+    public:
+      explicit DisjointSets(std::size_t size)
+        : Parents(size)
+      {
+        std::iota(Parents.begin(), Parents.end(), std::size_t(0));
+      }
+
+      std::size_t Find(std::size_t idx)
+      {
+        while (Parents[idx] != idx)
+        {
+          idx = Parents[idx] = Parents[Parents[idx]];
+        }
+        return idx;
+      }
+
+      void Join(std::size_t lh, std::size_t rh)
+      {
+        Parents[std::max(lh, rh)] = std::min(lh, rh);
+      }
+
+    private:
+      std::vector<std::size_t> Parents;
+    };
+
+    class LSHIndex : public Index
+    {
+    public:
+      void Add(std::size_t id, const Signature& signature) override
+      {
+        Ids.push_back(id);
+        Signatures.push_back(signature);
+      }
+
+      std::vector<std::vector<std::size_t>> FindClusters(uint_t similarity) const override
+      {
+        const auto total = Ids.size();
+        DisjointSets sets(total);
+        for (std::size_t band = 0; band != BANDS; ++band)
+        {
+          std::unordered_map<uint64_t, std::vector<std::size_t>> buckets;
+          for (std::size_t idx = 0; idx != total; ++idx)
+          {
+            auto& bucket = buckets[GetBandHash(Signatures[idx], band)];
+            for (const auto candidate : bucket)
+            {
+              const auto lh = sets.Find(candidate);
+              const auto rh = sets.Find(idx);
+              if (lh != rh && GetSimilarity(Signatures[candidate], Signatures[idx]) >= similarity)
+              {
+                sets.Join(lh, rh);
+              }
+            }
+            bucket.push_back(idx);
+          }
+        }
+        std::vector<std::vector<std::size_t>> clusters(total);
+        for (std::size_t idx = 0; idx != total; ++idx)
+        {
+          clusters[sets.Find(idx)].push_back(Ids[idx]);
+        }
+        clusters.erase(std::remove_if(clusters.begin(), clusters.end(),
+                                      [](const std::vector<std::size_t>& cluster) { return cluster.size() < 2; }),
+                       clusters.end());
+        return clusters;
+      }
+
+    private:
+      static uint64_t GetBandHash(const Signature& signature, std::size_t band)
+      {
+        uint64_t hash = band;
+        for (std::size_t row = 0; row != BAND_ROWS; ++row)
+        {
+          hash = Mix(hash ^ signature[band * BAND_ROWS + row]);
+        }
+        return hash;
+      }
+
+    private:
+      std::vector<std::size_t> Ids;
+      std::vector<Signature> Signatures;
+    };
+  }  // namespace
+
+  bool Calculate(const Holder& holder, Signature& result)
+  {
+    // emulated tunes do not provide chiptune to dump
+    const auto* aymHolder = dynamic_cast<const AYM::Holder*>(&holder);
+    const auto chiptune = aymHolder ? aymHolder->GetChiptune() : AYM::Chiptune::Ptr();
+    if (!chiptune)
+    {
+      return false;
+    }
+    // same as AYM::Holder::Dump, but stopped at the analyzed duration
+    auto trackParams = AYM::TrackParameters::Create(chiptune->GetProperties());
+    const auto iterator = chiptune->CreateDataIterator(std::move(trackParams));
+    const auto frameDuration = chiptune->GetFrameDuration();
+    const Time::Microseconds limit(DURATION);
+    ShinglesCollector collector;
+    for (Time::Microseconds pos; iterator->IsValid() && pos < limit; pos += frameDuration, iterator->NextFrame({}))
+    {
+      collector.Add(iterator->GetData());
+    }
+    return collector.GetSignature(result);
+  }
+
+  uint_t GetSimilarity(const Signature& lh, const Signature& rh)
+  {
+    const auto matched =
+        std::inner_product(lh.begin(), lh.end(), rh.begin(), std::size_t(0), std::plus<>(), std::equal_to<>());
+    return static_cast<uint_t>(matched * 100 / SIGNATURE_SIZE);
+  }
+
+  Index::Ptr Index::Create()
+  {
+    return Index::Ptr(new LSHIndex());
+  }
+}  // namespace Module::Fingerprint
@@ -0,0 +1,116 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Modules fingerprints test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include <iostream>
+#include <module/fingerprint/api.h>
+
+namespace
+{
+  using namespace Module::Fingerprint;
+
+  typedef std::vector<std::vector<std::size_t>> Clusters;
+
+  template<class T>
+  void Test(const std::string& msg, const T& result, const T& reference)
+  {
+    if (result == reference)
+    {
+      std::cout << "Passed test for " << msg << std::endl;
+    }
+    else
+    {
+      std::cout << "Failed test for " << msg << std::endl;
+      throw 1;
+    }
+  }
+
+  Signature MakeSignature(uint32_t seed)
+  {
+    Signature result;
+    for (auto& val : result)
+    {
+      seed = seed * 1664525 + 1013904223;
+      val = seed;
+    }
+    return result;
+  }
+
+  // changes specified rows of bands with 4 rows each
+  Signature Modify(Signature sig, std::size_t firstBand, std::size_t bands, std::size_t row)
+  {
+    for (std::size_t band = firstBand; band != firstBand + bands; ++band)
+    {
+      sig[band * 4 + row] ^= 0xdeadbeef;
+    }
+    return sig;
+  }
+
+  void TestSimilarity()
+  {
+    const auto sig = MakeSignature(1);
+    Test<uint_t>("identical similarity", GetSimilarity(sig, sig), 100);
+    Test<uint_t>("different similarity", GetSimilarity(sig, MakeSignature(2)), 0);
+    Test<uint_t>("quarter changed similarity", GetSimilarity(sig, Modify(sig, 0, 16, 0)), 75);
+    Test<uint_t>("half changed similarity", GetSimilarity(sig, Modify(Modify(sig, 0, 16, 0), 0, 16, 1)), 50);
+    Test<uint_t>("symmetric similarity", GetSimilarity(Modify(sig, 0, 8, 2), sig), 87);
+  }
+
+  void TestClusters()
+  {
+    const auto base = MakeSignature(10);
+    const auto near = Modify(base, 0, 8, 0);
+    const auto nearOfNear = Modify(near, 8, 8, 1);
+    const auto other = MakeSignature(20);
+    // whole half of bands changed
+    const auto halfOfOther = Modify(Modify(Modify(Modify(other, 0, 8, 0), 0, 8, 1), 0, 8, 2), 0, 8, 3);
+    const auto index = Index::Create();
+    Test("no items", index->FindClusters(DEFAULT_SIMILARITY), Clusters());
+    index->Add(100, nearOfNear);
+    index->Add(50, other);
+    index->Add(10, base);
+    index->Add(70, MakeSignature(30));
+    index->Add(20, near);
+    index->Add(60, halfOfOther);
+    index->Add(5, base);
+    Test("default similarity clusters", index->FindClusters(DEFAULT_SIMILARITY), Clusters{{100, 10, 20, 5}});
+    // base and nearOfNear are 75% similar, but joined through near
+    Test("transitive clusters", index->FindClusters(80), Clusters{{100, 10, 20, 5}});
+    Test("exact clusters", index->FindClusters(100), Clusters{{10, 5}});
+    Test("loose clusters", index->FindClusters(50), Clusters{{100, 10, 20, 5}, {50, 60}});
+  }
+
+  void TestBands()
+  {
+    const auto base = MakeSignature(40);
+    const auto index = Index::Create();
+    index->Add(1, base);
+    // 75% similar, but each band is changed
+    index->Add(2, Modify(base, 0, 16, 3));
+    // 71% similar, single matched band
+    index->Add(3, Modify(Modify(Modify(Modify(base, 0, 15, 0), 0, 1, 1), 0, 1, 2), 0, 1, 3));
+    Test<uint_t>("similarity to unmatched bands", GetSimilarity(base, Modify(base, 0, 16, 3)), 75);
+    Test("candidates by bands only", index->FindClusters(DEFAULT_SIMILARITY), Clusters{{1, 3}});
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    TestSimilarity();
+    TestClusters();
+    TestBands();
+    return 0;
+  }
+  catch (int code)
+  {
+    return code;
+  }
+}
@@ -281,7 +281,7 @@ namespace Module::AHX
   class Holder : public Module::Holder
   {
   public:
-    Holder(Binary::Dump tune, Parameters::Accessor::Ptr props)
+    Holder(Binary::Data::Ptr tune, Parameters::Accessor::Ptr props)
       : Tune(std::move(tune))
       , Properties(std::move(props))
     {}
@@ -290,7 +290,7 @@ namespace Module::AHX
     {
       if (!Info)
       {
-        Info = MakePtr<TrackInformation>(Tune);
+        Info = MakePtr<TrackInformation>(*Tune);
       }
       return Info;
     }
@@ -302,11 +302,11 @@ namespace Module::AHX
 
     Renderer::Ptr CreateRenderer(uint_t samplerate, Parameters::Accessor::Ptr /*params*/) const override
     {
-      return MakePtr<Renderer>(MakePtr<HVL>(Tune, samplerate));
+      return MakePtr<Renderer>(MakePtr<HVL>(*Tune, samplerate));
     }
 
   private:
-    const Binary::Dump Tune;
+    const Binary::Data::Ptr Tune;
     const Parameters::Accessor::Ptr Properties;
     mutable Information::Ptr Info;
   };
@@ -345,11 +345,7 @@ namespace Module::AHX
         {
           props.SetSource(*container);
           props.SetPlatform(Platforms::AMIGA);
-
-          // TODO: extract
-          const auto rawData = static_cast<const uint8_t*>(container->Start());
-          Binary::Dump tune(rawData, rawData + container->Size());
-          return MakePtr<Holder>(std::move(tune), std::move(properties));
+          return MakePtr<Holder>(container, std::move(properties));
         }
       }
       catch (const std::exception& e)
@@ -0,0 +1,25 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Parallel decoding of stream segments implementation
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+// local includes
+#include "module/players/segments.h"
+// library includes
+#include <core/core_parameters.h>
+
+namespace Module
+{
+  uint_t GetDecodeThreads(const Parameters::Accessor& params)
+  {
+    using namespace Parameters::ZXTune::Core;
+    Parameters::IntType threads = DECODE_THREADS_DEFAULT;
+    params.FindValue(DECODE_THREADS, threads);
+    return static_cast<uint_t>(threads);
+  }
+}  // namespace Module
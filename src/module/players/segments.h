@@ -0,0 +1,99 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Parallel decoding of stream segments
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// common includes
+#include <types.h>
+// library includes
+#include <async/pool.h>
+#include <parameters/accessor.h>
+// std includes
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace Module
+{
+  //! @return threads count to decode streamed formats in parallel, less than 2 for sequential decoding
+  uint_t GetDecodeThreads(const Parameters::Accessor& params);
+
+  // Decodes independent stream segments on limited amount of pooled threads. Frames are returned strictly in order of
+  // segments addition, so output is the same as for sequential decoding if segments are split at frame boundaries and
+  // decoder is properly warmed up by every task.
+  template<class FrameType>
+  class ParallelSegments
+  {
+  public:
+    using Frames = std::vector<FrameType>;
+    using Task = std::function<Frames()>;
+
+    explicit ParallelSegments(uint_t threads)
+      : Threads(threads)
+    {}
+
+    ~ParallelSegments()
+    {
+      Clear();
+    }
+
+    bool IsFull() const
+    {
+      return Pending.size() >= Threads;
+    }
+
+    void Add(Task task)
+    {
+      // exception is passed to the future
+      auto segment = std::make_shared<std::packaged_task<Frames()>>(std::move(task));
+      Pending.push_back(segment->get_future());
+      Async::ExecuteInPool([segment]() { (*segment)(); });
+    }
+
+    //! @return false if all the added segments are consumed
+    //! @throw exception from the decoding task
+    bool Next(FrameType& frame)
+    {
+      while (Current == Ready.size())
+      {
+        if (Pending.empty())
+        {
+          return false;
+        }
+        auto next = std::move(Pending.front());
+        Pending.pop_front();
+        Ready = next.get();
+        Current = 0;
+      }
+      frame = std::move(Ready[Current++]);
+      return true;
+    }
+
+    // waits for all the pending tasks
+    void Clear()
+    {
+      for (const auto& pending : Pending)
+      {
+        pending.wait();
+      }
+      Pending.clear();
+      Ready.clear();
+      Current = 0;
+    }
+
+  private:
+    const uint_t Threads;
+    std::deque<std::future<Frames>> Pending;
+    Frames Ready;
+    std::size_t Current = 0;
+  };
+}  // namespace Module
@@ -21,14 +21,17 @@ namespace Parameters
   public:
     /*explicit*/ constexpr Identifier(StringView sv)
       : Storage(std::move(sv))
+      , HashValue(Hash(Storage))
     {}
 
     /*explicit*/ constexpr Identifier(const char* str)
       : Storage(str)
+      , HashValue(Hash(Storage))
     {}
 
     /*explicit*/ constexpr Identifier(const String& str)
       : Storage(str)
+      , HashValue(Hash(Storage))
     {}
 
     constexpr operator StringView() const
@@ -38,7 +41,7 @@ namespace Parameters
 
     constexpr bool operator==(Identifier rh) const
     {
-      return Storage == rh.Storage;
+      return HashValue == rh.HashValue && Storage == rh.Storage;
     }
 
     constexpr bool operator==(StringView rh) const
@@ -46,6 +49,12 @@ namespace Parameters
       return Storage == rh;
     }
 
+    //! Stable hash of the whole identifier, the same for all the ways of construction
+    constexpr uint32_t GetHash() const
+    {
+      return HashValue;
+    }
+
     constexpr bool IsEmpty() const
     {
       return Storage.empty();
@@ -85,13 +94,26 @@ namespace Parameters
       return Storage.to_string();
     }
 
+    // FNV-1a
+    static constexpr uint32_t Hash(StringView str)
+    {
+      uint32_t result = 2166136261u;
+      for (const auto sym : str)
+      {
+        result = (result ^ static_cast<uint8_t>(sym)) * 16777619u;
+      }
+      return result;
+    }
+
   private:
     constexpr Identifier()
       : Storage()
+      , HashValue(Hash(Storage))
     {}
 
-    constexpr Identifier(const Char* str, std::size_t size)
+    constexpr Identifier(const Char* str, std::size_t size, uint32_t hash)
       : Storage(str, size)
+      , HashValue(hash)
     {}
 
   private:
@@ -99,6 +121,7 @@ namespace Parameters
     template<Char...>
     friend class StaticIdentifier;
     const StringView Storage;
+    const uint32_t HashValue;
   };
 
   template<Char... Symbols>
@@ -107,7 +130,7 @@ namespace Parameters
   public:
     constexpr operator Identifier() const
     {
-      return {Storage.data(), Storage.size()};
+      return {Storage.data(), Storage.size(), HashValue};
     }
 
     template<Char... AnotherSymbols>
@@ -119,6 +142,7 @@ namespace Parameters
 
   private:
     constexpr static const std::array<Char, sizeof...(Symbols)> Storage = {Symbols...};
+    constexpr static const uint32_t HashValue = Identifier::Hash({Storage.data(), Storage.size()});
   };
 
   template<typename CharType, CharType... Symbols>
@@ -0,0 +1,21 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Parameters snapshot factory
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// library includes
+#include <parameters/accessor.h>
+
+namespace Parameters
+{
+  //! @brief Resolves all the values visible through source (e.g. merged chain) into flat immutable storage
+  //! @invariant Version is fixed at the moment of creation
+  Accessor::Ptr CreateSnapshot(const Accessor& source);
+}  // namespace Parameters
@@ -12,8 +12,9 @@
 #include <make_ptr.h>
 // library includes
 #include <parameters/container.h>
+#include <parameters/snapshot.h>
+#include <parameters/src/hashed_map.h>
 // std includes
-#include <map>
 #include <utility>
 
 namespace Parameters
@@ -95,74 +96,83 @@ namespace Parameters
     }
 
   private:
-    template<class T>
-    class TransientMap
+    uint_t VersionValue;
+    HashedMap<IntType> Integers;
+    HashedMap<StringType> Strings;
+    HashedMap<DataType> Datas;
+  };
+
+  // Immutable flat copy of any accessor with all the types kept independently
+  class SnapshotAccessor : public Accessor
+  {
+  public:
+    explicit SnapshotAccessor(const Accessor& source)
+      : VersionValue(source.Version())
     {
-    public:
-      TransientMap() = default;
-      TransientMap(const TransientMap<T>& rh)
-        : Storage(rh.Storage)
-      {}
+      Filler filler(*this);
+      source.Process(filler);
+    }
 
-      bool Find(StringView name, T& res) const
-      {
-        const auto it = Storage.find(name);
-        return it != Storage.end() ? (res = it->second, true) : false;
-      }
+    uint_t Version() const override
+    {
+      return VersionValue;
+    }
 
-      void Visit(Visitor& visitor) const
-      {
-        for (const auto& entry : Storage)
-        {
-          visitor.SetValue(entry.first, entry.second);
-        }
-      }
+    bool FindValue(Identifier name, IntType& val) const override
+    {
+      return Integers.Find(name, val);
+    }
 
-      bool Erase(StringView name)
-      {
-        const auto it = Storage.find(name);
-        return it != Storage.end() ? (Storage.erase(it), true) : false;
-      }
+    bool FindValue(Identifier name, StringType& val) const override
+    {
+      return Strings.Find(name, val);
+    }
 
-      template<class Ref>
-      bool Update(StringView name, Ref value)
-      {
-        const auto lower = Storage.lower_bound(name);
-        if (lower != Storage.end() && lower->first == name)
-        {
-          return Update(lower->second, value);
-        }
-        const auto it = Storage.insert(lower, {name.to_string(), {}});
-        return Update(it->second, value);
-      }
+    bool FindValue(Identifier name, DataType& val) const override
+    {
+      return Datas.Find(name, val);
+    }
 
-    private:
-      static bool Update(IntType& ref, IntType update)
+    void Process(Visitor& visitor) const override
+    {
+      Integers.Visit(visitor);
+      Strings.Visit(visitor);
+      Datas.Visit(visitor);
+    }
+
+  private:
+    // unlike StorageContainer, keeps values of different types with the same name
+    class Filler : public Visitor
+    {
+    public:
+      explicit Filler(SnapshotAccessor& self)
+        : Self(self)
+      {}
+
+      void SetValue(Identifier name, IntType val) override
       {
-        return ref != update ? (ref = update, true) : false;
+        Self.Integers.Update(name, val);
       }
 
-      static bool Update(StringType& ref, StringView update)
+      void SetValue(Identifier name, StringView val) override
       {
-        return ref != update ? (ref = update.to_string(), true) : false;
+        Self.Strings.Update(name, val);
       }
 
-      static bool Update(DataType& ref, Binary::View update)
+      void SetValue(Identifier name, Binary::View val) override
       {
-        const auto* raw = update.As<uint8_t>();
-        ref.assign(raw, raw + update.Size());
-        return true;
+        Self.Datas.Update(name, val);
       }
 
     private:
-      std::map<String, T, std::less<>> Storage;
+      SnapshotAccessor& Self;
     };
 
   private:
-    uint_t VersionValue;
-    TransientMap<IntType> Integers;
-    TransientMap<StringType> Strings;
-    TransientMap<DataType> Datas;
+    const uint_t VersionValue;
+    HashedMap<IntType> Integers;
+    HashedMap<StringType> Strings;
+    HashedMap<DataType> Datas;
   };
 
   class CompositeContainer : public Container
@@ -246,4 +256,9 @@ namespace Parameters
   {
     return MakePtr<CompositeContainer>(std::move(accessor), std::move(modifier));
   }
+
+  Accessor::Ptr CreateSnapshot(const Accessor& source)
+  {
+    return MakePtr<SnapshotAccessor>(source);
+  }
 }  // namespace Parameters
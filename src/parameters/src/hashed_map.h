@@ -0,0 +1,188 @@
+/**
+ *
+ * @file
+ *
+ * @brief  Flat hashed map for parameters storage
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#pragma once
+
+// library includes
+#include <parameters/identifier.h>
+#include <parameters/types.h>
+#include <parameters/visitor.h>
+// std includes
+#include <algorithm>
+#include <vector>
+
+namespace Parameters
+{
+  // Open addressing with linear probing and backward shift deletion, so no tombstones are required.
+  // Empty map does not allocate anything.
+  template<class T>
+  class HashedMap
+  {
+  public:
+    bool Find(Identifier name, T& res) const
+    {
+      if (const auto* entry = Lookup(name))
+      {
+        res = entry->Value;
+        return true;
+      }
+      return false;
+    }
+
+    // in names order to keep output stable
+    void Visit(Visitor& visitor) const
+    {
+      std::vector<const Entry*> entries;
+      entries.reserve(Size);
+      for (const auto& entry : Entries)
+      {
+        if (entry.Used)
+        {
+          entries.push_back(&entry);
+        }
+      }
+      std::sort(entries.begin(), entries.end(), [](const Entry* lh, const Entry* rh) { return lh->Name < rh->Name; });
+      for (const auto* entry : entries)
+      {
+        visitor.SetValue(entry->Name, entry->Value);
+      }
+    }
+
+    bool Erase(Identifier name)
+    {
+      if (const auto* entry = Lookup(name))
+      {
+        EraseAt(entry - Entries.data());
+        return true;
+      }
+      return false;
+    }
+
+    template<class Ref>
+    bool Update(Identifier name, Ref value)
+    {
+      if (auto* entry = const_cast<Entry*>(Lookup(name)))
+      {
+        return Update(entry->Value, value);
+      }
+      Reserve(Size + 1);
+      auto& entry = Entries[FindFree(name.GetHash())];
+      entry.Used = true;
+      entry.Hash = name.GetHash();
+      entry.Name = name.AsString();
+      ++Size;
+      Update(entry.Value, value);
+      return true;
+    }
+
+  private:
+    struct Entry
+    {
+      bool Used = false;
+      uint32_t Hash = 0;
+      String Name;
+      T Value = {};
+    };
+
+    std::size_t GetMask() const
+    {
+      return Entries.size() - 1;
+    }
+
+    const Entry* Lookup(Identifier name) const
+    {
+      if (!Size)
+      {
+        return nullptr;
+      }
+      const auto hash = name.GetHash();
+      const auto mask = GetMask();
+      for (auto idx = hash & mask;; idx = (idx + 1) & mask)
+      {
+        const auto& entry = Entries[idx];
+        if (!entry.Used)
+        {
+          return nullptr;
+        }
+        else if (entry.Hash == hash && name == StringView(entry.Name))
+        {
+          return &entry;
+        }
+      }
+    }
+
+    std::size_t FindFree(uint32_t hash) const
+    {
+      const auto mask = GetMask();
+      auto idx = hash & mask;
+      while (Entries[idx].Used)
+      {
+        idx = (idx + 1) & mask;
+      }
+      return idx;
+    }
+
+    // keep load factor not more than 1/2
+    void Reserve(std::size_t size)
+    {
+      if (size * 2 <= Entries.size())
+      {
+        return;
+      }
+      std::vector<Entry> entries(std::max<std::size_t>(Entries.size() * 2, 8));
+      entries.swap(Entries);
+      for (auto& entry : entries)
+      {
+        if (entry.Used)
+        {
+          Entries[FindFree(entry.Hash)] = std::move(entry);
+        }
+      }
+    }
+
+    void EraseAt(std::size_t idx)
+    {
+      const auto mask = GetMask();
+      for (auto next = (idx + 1) & mask; Entries[next].Used; next = (next + 1) & mask)
+      {
+        const auto home = Entries[next].Hash & mask;
+        // entry may be moved only if free cell lays between its home and current position
+        if (((next - home) & mask) >= ((next - idx) & mask))
+        {
+          Entries[idx] = std::move(Entries[next]);
+          idx = next;
+        }
+      }
+      Entries[idx] = Entry();
+      --Size;
+    }
+
+    static bool Update(IntType& ref, IntType update)
+    {
+      return ref != update ? (ref = update, true) : false;
+    }
+
+    static bool Update(StringType& ref, StringView update)
+    {
+      return ref != update ? (ref = update.to_string(), true) : false;
+    }
+
+    static bool Update(DataType& ref, Binary::View update)
+    {
+      const auto* raw = update.As<uint8_t>();
+      ref.assign(raw, raw + update.Size());
+      return true;
+    }
+
+  private:
+    std::vector<Entry> Entries;
+    std::size_t Size = 0;
+  };
+}  // namespace Parameters
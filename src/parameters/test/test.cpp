@@ -9,10 +9,14 @@
  **/
 
 #include <parameters/container.h>
+#include <parameters/merged_accessor.h>
+#include <parameters/snapshot.h>
 #include <parameters/types.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <map>
 
 template<class T>
 std::ostream& operator<<(std::ostream& s, const std::vector<T>& v)
@@ -106,6 +110,14 @@ namespace
       Test("three + two", three + two, "one.two.three.one.two"_sv);
       Test("three + three", three + three, "one.two.three.one.two.three"_sv);
     }
+
+    {
+      static_assert(Identifier(three).GetHash() == Identifier("one.two.three").GetHash(), "Static hash mismatch");
+      const String dynamic = "one.two.three";
+      Test("three.GetHash()", Identifier(three).GetHash(), Identifier(dynamic).GetHash());
+      Test("three == dynamic", Identifier(three) == Identifier(dynamic), true);
+      Test("two.GetHash()", Identifier(two).GetHash() != Identifier(three).GetHash(), true);
+    }
   }
 
   class CountingVisitor : public Parameters::Visitor
@@ -288,6 +300,65 @@ namespace
     }
     Test("final version", cont->Version(), 14u);
   }
+
+  void TestManyValues()
+  {
+    std::cout << "---- Test for Parameters::Container with many values" << std::endl;
+    const auto cont = Parameters::Container::Create();
+    std::map<String, Parameters::IntType> reference;
+    for (Parameters::IntType idx = 0; idx != 1000; ++idx)
+    {
+      const auto name = "zxtune.value" + std::to_string(idx * 7919 % 1000);
+      cont->SetValue(name, idx);
+      reference[name] = idx;
+      if (idx % 3 == 0)
+      {
+        const auto toRemove = "zxtune.value" + std::to_string(idx * 31 % 1000);
+        cont->RemoveValue(toRemove);
+        reference.erase(toRemove);
+      }
+    }
+    CountingVisitor cnt;
+    cont->Process(cnt);
+    Test("count", cnt.Integers.size(), reference.size());
+    Test("ordered", std::is_sorted(cnt.Names.begin(), cnt.Names.end()), true);
+    for (Parameters::IntType idx = 0; idx != 1000; ++idx)
+    {
+      const auto name = "zxtune.value" + std::to_string(idx);
+      const auto it = reference.find(name);
+      Parameters::IntType val = 0;
+      if (cont->FindValue(name, val) != (it != reference.end()) || (it != reference.end() && val != it->second))
+      {
+        Test("find " + name, false, true);
+      }
+    }
+    std::cout << "Passed test for lookups" << std::endl;
+  }
+
+  void TestSnapshot()
+  {
+    std::cout << "---- Test for Parameters::CreateSnapshot" << std::endl;
+    const auto first = Parameters::Container::Create();
+    const auto second = Parameters::Container::Create();
+    const Parameters::IntType int1 = 1, int2 = 2;
+    const Parameters::StringType str1 = "a", str2 = "b";
+    first->SetValue("int", int1);
+    first->SetValue("str", str1);
+    second->SetValue("int", int2);
+    second->SetValue("str", int2);
+    second->SetValue("other", str2);
+    const auto merged = Parameters::CreateMergedAccessor(first, second);
+    const auto snapshot = Parameters::CreateSnapshot(*merged);
+    Test("version", snapshot->Version(), merged->Version());
+    TestFind(*snapshot, "int", &int1);
+    TestFind(*snapshot, "str", &str1);
+    TestFind(*snapshot, "str", &int2);
+    TestFind(*snapshot, "other", &str2);
+    TestFind(*snapshot, "other", static_cast<const Parameters::IntType*>(nullptr));
+    first->SetValue("int", int2);
+    TestFind(*snapshot, "int", &int1);
+    Test("fixed version", snapshot->Version() != merged->Version(), true);
+  }
 }  // namespace
 
 int main()
@@ -296,6 +367,8 @@ int main()
   {
     TestIdentifier();
     TestContainer();
+    TestManyValues();
+    TestSnapshot();
   }
   catch (int code)
   {
@@ -20,14 +20,18 @@
 #include <contract.h>
 #include <error_tools.h>
 #include <make_ptr.h>
+#include <pointers.h>
 // library includes
 #include <debug/log.h>
+#include <debug/trace.h>
 #include <math/numeric.h>
 #include <sound/backend_attrs.h>
 #include <sound/backends_parameters.h>
 #include <sound/render_params.h>
 #include <sound/sound_parameters.h>
 // std includes
+#include <cerrno>
+#include <cstring>
 #include <functional>
 // boost includes
 #include <boost/algorithm/string/classification.hpp>
@@ -41,9 +45,15 @@ namespace Sound::Alsa
 
   const uint_t CAPABILITIES = CAP_TYPE_SYSTEM | CAP_FEAT_HWVOLUME;
 
-  const uint_t LATENCY_MIN = 20;
+  const uint_t LATENCY_MIN = 5;
   const uint_t LATENCY_MAX = 10000;
 
+  // hardware buffer is split to such count of periods in memory-mapped mode
+  const uint_t MMAP_PERIODS = 2;
+  const int WAIT_TIMEOUT_MS = 1000;
+
+  const Debug::Trace::Counter Underruns("Sound::Backend::Alsa::Underruns");
+
   inline void CheckResult(Api& api, int res, Error::LocationRef loc)
   {
     if (res < 0)
@@ -247,8 +257,9 @@ namespace Sound::Alsa
         // do not break if error while drain- we need to close
         AlsaApi->snd_pcm_drain(Handle);
         AlsaApi->snd_pcm_hw_free(Handle);
-        Dbg("Closing PCM device '{}'", Name);
+        Dbg("Closing PCM device '{}' ({} underruns)", Name, UnderrunsCount);
         CheckResult(AlsaApi->snd_pcm_close(Release()), THIS_LINE);
+        UnderrunsCount = 0;
       }
     }
 
@@ -258,20 +269,98 @@ namespace Sound::Alsa
       std::size_t size = buffer.size();
       while (size)
       {
-        snd_pcm_sframes_t res = AlsaApi->snd_pcm_writei(Handle, data, size);
-        if (res < 0)
-        {
-          res = AlsaApi->snd_pcm_recover(Handle, res, 1);
-        }
+        const snd_pcm_sframes_t res = AlsaApi->snd_pcm_writei(Handle, data, size);
         if (res < 0)
         {
-          CheckedCall(&Api::snd_pcm_prepare, THIS_LINE);
+          Recover(static_cast<int>(res));
           continue;
         }
         data += res;
         size -= res;
       }
     }
+
+    // Copies data directly to hardware buffer by pieces not less than period (except the last one)
+    // Chunk may be already packed to device format, so data is advanced by frame size of hardware buffer
+    void WriteMapped(const Chunk& buffer, snd_pcm_uframes_t period)
+    {
+      const auto* data = safe_ptr_cast<const uint8_t*>(buffer.data());
+      std::size_t size = buffer.size();
+      while (size)
+      {
+        const snd_pcm_sframes_t avail = AlsaApi->snd_pcm_avail_update(Handle);
+        if (avail < 0)
+        {
+          Recover(static_cast<int>(avail));
+          continue;
+        }
+        else if (static_cast<std::size_t>(avail) < std::min<std::size_t>(size, period))
+        {
+          WaitForPeriod();
+          continue;
+        }
+        const snd_pcm_channel_area_t* areas = nullptr;
+        snd_pcm_uframes_t offset = 0;
+        snd_pcm_uframes_t frames = std::min<std::size_t>(size, avail);
+        if (const int res = AlsaApi->snd_pcm_mmap_begin(Handle, &areas, &offset, &frames))
+        {
+          Recover(res);
+          continue;
+        }
+        // interleaved access uses the same area for all the channels
+        auto* const target = static_cast<uint8_t*>(areas[0].addr) + (areas[0].first + offset * areas[0].step) / 8;
+        const std::size_t bytes = frames * areas[0].step / 8;
+        std::memcpy(target, data, bytes);
+        const snd_pcm_sframes_t committed = AlsaApi->snd_pcm_mmap_commit(Handle, offset, frames);
+        if (committed < 0 || static_cast<snd_pcm_uframes_t>(committed) != frames)
+        {
+          Recover(committed < 0 ? static_cast<int>(committed) : -EPIPE);
+          continue;
+        }
+        data += bytes;
+        size -= frames;
+      }
+    }
+
+    // stream is not started until start threshold is reached, so it cannot be paused in that state
+    void Pause(bool enable)
+    {
+      const auto expected = enable ? SND_PCM_STATE_RUNNING : SND_PCM_STATE_PAUSED;
+      if (AlsaApi->snd_pcm_state(Handle) == expected)
+      {
+        CheckedCall(&Api::snd_pcm_pause, int(enable), THIS_LINE);
+      }
+    }
+
+  private:
+    // playback is started only when whole buffer is filled
+    void WaitForPeriod()
+    {
+      if (AlsaApi->snd_pcm_state(Handle) == SND_PCM_STATE_PREPARED)
+      {
+        CheckedCall(&Api::snd_pcm_start, THIS_LINE);
+      }
+      else if (const int res = AlsaApi->snd_pcm_wait(Handle, WAIT_TIMEOUT_MS); res < 0)
+      {
+        Recover(res);
+      }
+    }
+
+    void Recover(int err)
+    {
+      if (err == -EPIPE)
+      {
+        ++UnderrunsCount;
+        Underruns.Add();
+      }
+      if (AlsaApi->snd_pcm_recover(Handle, err, 1) < 0)
+      {
+        CheckedCall(&Api::snd_pcm_prepare, THIS_LINE);
+      }
+    }
+
+  private:
+    uint_t UnderrunsCount = 0;
   };
 
   template<class T>
@@ -292,6 +381,7 @@ namespace Sound::Alsa
       , Pcm(api, id)
       , CanPause(false)
       , Format(SND_PCM_FORMAT_UNKNOWN)
+      , Period(0)
     {}
 
     ~DeviceWrapper()
@@ -304,7 +394,7 @@ namespace Sound::Alsa
       {}
     }
 
-    void SetParameters(Time::Milliseconds lat, const RenderParameters& params)
+    void SetParameters(Time::Milliseconds lat, bool mmap, const RenderParameters& params)
     {
       const std::shared_ptr<snd_pcm_hw_params_t> hwParams =
           Allocate<snd_pcm_hw_params_t>(AlsaApi, &Api::snd_pcm_hw_params_malloc, &Api::snd_pcm_hw_params_free);
@@ -325,14 +415,23 @@ namespace Sound::Alsa
 
       const unsigned freq = params.SoundFreq();
       const unsigned latency = Time::Microseconds(lat).Get();
-      Dbg("Setting parameters: rate={}Hz latency={}uS", freq, latency);
-      Pcm.CheckedCall(&Api::snd_pcm_set_params, fmt.Get(), SND_PCM_ACCESS_RW_INTERLEAVED, unsigned(Sample::CHANNELS),
-                      freq, 1, latency, THIS_LINE);
+      snd_pcm_uframes_t period = 0;
+      if (mmap)
+      {
+        period = SetMappedParameters(*hwParams, fmt.Get(), freq, latency);
+      }
+      else
+      {
+        Dbg("Setting parameters: rate={}Hz latency={}uS", freq, latency);
+        Pcm.CheckedCall(&Api::snd_pcm_set_params, fmt.Get(), SND_PCM_ACCESS_RW_INTERLEAVED, unsigned(Sample::CHANNELS),
+                        freq, 1, latency, THIS_LINE);
+      }
 
       Pcm.CheckedCall(&Api::snd_pcm_prepare, THIS_LINE);
 
       CanPause = canPause;
       Format = fmt.Get();
+      Period = period;
     }
 
     void Close()
@@ -340,6 +439,7 @@ namespace Sound::Alsa
       Pcm.Close();
       CanPause = false;
       Format = SND_PCM_FORMAT_UNKNOWN;
+      Period = 0;
     }
 
     void Write(Chunk& buffer)
@@ -357,14 +457,21 @@ namespace Sound::Alsa
         assert(!"Unsupported format");
         break;
       }
-      Pcm.Write(buffer);
+      if (Period)
+      {
+        Pcm.WriteMapped(buffer, Period);
+      }
+      else
+      {
+        Pcm.Write(buffer);
+      }
     }
 
     void Pause()
     {
       if (CanPause)
       {
-        Pcm.CheckedCall(&Api::snd_pcm_pause, 1, THIS_LINE);
+        Pcm.Pause(true);
       }
     }
 
@@ -372,15 +479,57 @@ namespace Sound::Alsa
     {
       if (CanPause)
       {
-        Pcm.CheckedCall(&Api::snd_pcm_pause, 0, THIS_LINE);
+        Pcm.Pause(false);
       }
     }
 
+  private:
+    //! @return period size in frames
+    snd_pcm_uframes_t SetMappedParameters(snd_pcm_hw_params_t& hwParams, snd_pcm_format_t format, unsigned freq,
+                                          unsigned latency)
+    {
+      Dbg("Setting memory-mapped parameters: rate={}Hz latency={}uS periods={}", freq, latency, MMAP_PERIODS);
+      Pcm.CheckedCall(&Api::snd_pcm_hw_params_set_access, &hwParams, SND_PCM_ACCESS_MMAP_INTERLEAVED, THIS_LINE);
+      Pcm.CheckedCall(&Api::snd_pcm_hw_params_set_format, &hwParams, format, THIS_LINE);
+      Pcm.CheckedCall(&Api::snd_pcm_hw_params_set_channels, &hwParams, unsigned(Sample::CHANNELS), THIS_LINE);
+      unsigned rate = freq;
+      Pcm.CheckedCall(&Api::snd_pcm_hw_params_set_rate_near, &hwParams, &rate, static_cast<int*>(nullptr), THIS_LINE);
+      if (rate != freq)
+      {
+        throw MakeFormattedError(THIS_LINE, translate("Error in ALSA backend: sample rate {}Hz is not supported."),
+                                 freq);
+      }
+      unsigned bufferTime = latency;
+      Pcm.CheckedCall(&Api::snd_pcm_hw_params_set_buffer_time_near, &hwParams, &bufferTime, static_cast<int*>(nullptr),
+                      THIS_LINE);
+      unsigned periodTime = bufferTime / MMAP_PERIODS;
+      Pcm.CheckedCall(&Api::snd_pcm_hw_params_set_period_time_near, &hwParams, &periodTime, static_cast<int*>(nullptr),
+                      THIS_LINE);
+      Pcm.CheckedCall(&Api::snd_pcm_hw_params, &hwParams, THIS_LINE);
+
+      snd_pcm_uframes_t bufferSize = 0;
+      snd_pcm_uframes_t periodSize = 0;
+      CheckResult(*AlsaApi, AlsaApi->snd_pcm_hw_params_get_buffer_size(&hwParams, &bufferSize), THIS_LINE);
+      CheckResult(*AlsaApi, AlsaApi->snd_pcm_hw_params_get_period_size(&hwParams, &periodSize, nullptr), THIS_LINE);
+      Dbg("Using buffer of {} frames ({}uS) with period of {} frames ({}uS)", bufferSize, bufferTime, periodSize,
+          periodTime);
+
+      const std::shared_ptr<snd_pcm_sw_params_t> swParams =
+          Allocate<snd_pcm_sw_params_t>(AlsaApi, &Api::snd_pcm_sw_params_malloc, &Api::snd_pcm_sw_params_free);
+      Pcm.CheckedCall(&Api::snd_pcm_sw_params_current, swParams.get(), THIS_LINE);
+      Pcm.CheckedCall(&Api::snd_pcm_sw_params_set_start_threshold, swParams.get(), bufferSize, THIS_LINE);
+      Pcm.CheckedCall(&Api::snd_pcm_sw_params_set_avail_min, swParams.get(), periodSize, THIS_LINE);
+      Pcm.CheckedCall(&Api::snd_pcm_sw_params, swParams.get(), THIS_LINE);
+      return periodSize;
+    }
+
   private:
     const Api::Ptr AlsaApi;
     PCMDevice Pcm;
     bool CanPause;
     snd_pcm_format_t Format;
+    // non-zero for memory-mapped mode
+    snd_pcm_uframes_t Period;
   };
 
   class MixerElementsIterator
@@ -694,6 +843,13 @@ namespace Sound::Alsa
       return Time::Milliseconds(val);
     }
 
+    bool UseMmap() const
+    {
+      Parameters::IntType val = Parameters::ZXTune::Sound::Backends::Alsa::MMAP_DEFAULT;
+      Accessor.FindValue(Parameters::ZXTune::Sound::Backends::Alsa::MMAP, val);
+      return val != 0;
+    }
+
   private:
     const Parameters::Accessor& Accessor;
   };
@@ -765,7 +921,7 @@ namespace Sound::Alsa
 
       AlsaObjects res;
       res.Dev = MakePtr<DeviceWrapper>(AlsaApi, deviceId);
-      res.Dev->SetParameters(backend.GetLatency(), *sound);
+      res.Dev->SetParameters(backend.GetLatency(), backend.UseMmap(), *sound);
       res.Mix = MakePtr<Mixer>(AlsaApi, deviceId, backend.GetMixerName());
       res.Vol = MakePtr<VolumeControl>(res.Mix);
       return res;
@@ -18,6 +18,7 @@
 // library includes
 #include <async/worker.h>
 #include <debug/log.h>
+#include <debug/trace.h>
 #include <module/players/pipeline.h>
 #include <parameters/tracking_helper.h>
 #include <sound/impl/fft_analyzer.h>
@@ -31,6 +32,9 @@
 namespace Sound::BackendBase
 {
   const Debug::Stream Dbg("Sound::Backend::Base");
+  const Debug::Trace::Scope RenderScope("Sound::Backend::Render");
+  const Debug::Trace::Scope FrameFinishScope("Sound::Backend::FrameFinish");
+  const Debug::Trace::Histogram FrameSamples("Sound::Backend::FrameSamples");
 
   class CallbackOverWorker : public BackendCallback
   {
@@ -256,10 +260,15 @@ namespace Sound::BackendBase
     {
       try
       {
-        auto data = Renderer->Render(*Looped);
+        auto data = [this]() {
+          const Debug::Trace::Span span(RenderScope);
+          return Renderer->Render(*Looped);
+        }();
         if (!data.empty())
         {
           Playing = true;
+          FrameSamples.Add(data.size());
+          const Debug::Trace::Span span(FrameFinishScope);
           Worker->FrameFinish(std::move(data));
         }
         else
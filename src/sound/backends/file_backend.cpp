@@ -12,6 +12,7 @@
 #include "sound/backends/file_backend.h"
 #include "sound/backends/l10n.h"
 // common includes
+#include <contract.h>
 #include <make_ptr.h>
 #include <progress_callback.h>
 // library includes
@@ -25,6 +26,8 @@
 #include <parameters/convert.h>
 #include <parameters/template.h>
 #include <sound/backends_parameters.h>
+// std includes
+#include <algorithm>
 
 #define FILE_TAG B4CB6B0C
 
@@ -321,6 +324,63 @@ namespace Sound::File
     std::unique_ptr<StreamSource> Source;
     Receiver::Ptr Stream;
   };
+
+  class FanoutBackendWorker : public Sound::BackendWorker
+  {
+  public:
+    explicit FanoutBackendWorker(std::vector<Sound::BackendWorker::Ptr> workers)
+      : Workers(std::move(workers))
+    {
+      Require(!Workers.empty());
+    }
+
+    void Startup() override
+    {
+      for (const auto& worker : Workers)
+      {
+        worker->Startup();
+      }
+    }
+
+    void Shutdown() override
+    {
+      for (const auto& worker : Workers)
+      {
+        worker->Shutdown();
+      }
+    }
+
+    void Pause() override {}
+
+    void Resume() override {}
+
+    void FrameStart(const Module::State& state) override
+    {
+      for (const auto& worker : Workers)
+      {
+        worker->FrameStart(state);
+      }
+    }
+
+    void FrameFinish(Chunk buffer) override
+    {
+      for (auto it = Workers.begin(), lim = Workers.end() - 1; it != lim; ++it)
+      {
+        Chunk copy(buffer.size());
+        std::copy(buffer.begin(), buffer.end(), copy.begin());
+        (*it)->FrameFinish(std::move(copy));
+      }
+      Workers.back()->FrameFinish(std::move(buffer));
+    }
+
+    VolumeControl::Ptr GetVolumeControl() const override
+    {
+      return VolumeControl::Ptr();
+    }
+
+  private:
+    const std::vector<Sound::BackendWorker::Ptr> Workers;
+  };
 }  // namespace Sound::File
 
 namespace Sound
@@ -330,6 +390,11 @@ namespace Sound
   {
     return MakePtr<File::BackendWorker>(std::move(params), std::move(properties), std::move(factory));
   }
+
+  BackendWorker::Ptr CreateFileBackendsFanoutWorker(std::vector<BackendWorker::Ptr> workers)
+  {
+    return MakePtr<File::FanoutBackendWorker>(std::move(workers));
+  }
 }  // namespace Sound
 
 #undef FILE_TAG
@@ -15,6 +15,8 @@
 // library includes
 #include <binary/output_stream.h>
 #include <sound/receiver.h>
+// std includes
+#include <vector>
 
 namespace Sound
 {
@@ -48,4 +50,7 @@ namespace Sound
 
   BackendWorker::Ptr CreateFileBackendWorker(Parameters::Accessor::Ptr params, Parameters::Accessor::Ptr properties,
                                              FileStreamFactory::Ptr factory);
+
+  // Passes single rendered stream to all the specified file backends workers
+  BackendWorker::Ptr CreateFileBackendsFanoutWorker(std::vector<BackendWorker::Ptr> workers);
 }  // namespace Sound
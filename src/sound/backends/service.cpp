@@ -11,19 +11,25 @@
 // local includes
 #include "sound/backends/backend_impl.h"
 #include "sound/backends/backends_list.h"
+#include "sound/backends/file_backend.h"
 #include "sound/backends/l10n.h"
 #include "sound/backends/storage.h"
 // common includes
 #include <error_tools.h>
 #include <make_ptr.h>
 // library includes
+#include <core/core_parameters.h>
 #include <debug/log.h>
+#include <parameters/container.h>
+#include <parameters/merged_accessor.h>
 #include <sound/backend_attrs.h>
 #include <sound/backends_parameters.h>
 #include <sound/service.h>
 // boost includes
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
+// std includes
+#include <thread>
 
 #define FILE_TAG A6428476
 
@@ -31,6 +37,8 @@ namespace Sound
 {
   const Debug::Stream Dbg("Sound::Backend");
 
+  const Parameters::IntType FANOUT_BUFFERS = 8;
+
   class StaticBackendInformation : public BackendInformation
   {
   public:
@@ -109,7 +117,13 @@ namespace Sound
       {
         if (const auto factory = FindFactory(backendId))
         {
-          return Sound::CreateBackend(Options, module, std::move(callback), factory->CreateWorker(Options, module));
+          const auto params = IsFileBackend(backendId) ? CreateOfflineParameters() : Options;
+          return Sound::CreateBackend(params, module, std::move(callback), factory->CreateWorker(params, module));
+        }
+        else if (backendId.find(BACKENDS_DELIMITER) != String::npos)
+        {
+          return Sound::CreateBackend(CreateOfflineParameters(), module, std::move(callback),
+                                      CreateFanoutWorker(backendId, module));
         }
         throw MakeFormattedError(THIS_LINE, translate("Backend '{}' not registered."), backendId);
       }
@@ -165,6 +179,42 @@ namespace Sound
       return ids;
     }
 
+    BackendWorker::Ptr CreateFanoutWorker(const String& backendIds, Module::Holder::Ptr module) const
+    {
+      Strings::Array ids;
+      boost::algorithm::split(ids, backendIds, boost::algorithm::is_any_of(String(1, BACKENDS_DELIMITER)));
+      // save every stream in separate thread by default
+      const auto asyncSaving = Parameters::Container::Create();
+      asyncSaving->SetValue(Parameters::ZXTune::Sound::Backends::File::BUFFERS, FANOUT_BUFFERS);
+      const auto params = Parameters::CreateMergedAccessor(Options, asyncSaving);
+      std::vector<BackendWorker::Ptr> workers;
+      for (const auto& id : ids)
+      {
+        const auto factory = FindFactory(id);
+        if (!factory || !IsFileBackend(id))
+        {
+          throw MakeFormattedError(THIS_LINE, translate("Backend '{}' cannot be used along with others."), id);
+        }
+        workers.push_back(factory->CreateWorker(params, module));
+      }
+      return CreateFileBackendsFanoutWorker(std::move(workers));
+    }
+
+    // file backends are not limited by realtime, so streamed formats may be decoded in parallel
+    Parameters::Accessor::Ptr CreateOfflineParameters() const
+    {
+      const auto offline = Parameters::Container::Create();
+      offline->SetValue(Parameters::ZXTune::Core::DECODE_THREADS, std::thread::hardware_concurrency());
+      return Parameters::CreateMergedAccessor(Options, offline);
+    }
+
+    bool IsFileBackend(const String& id) const
+    {
+      const auto it = std::find_if(Infos.begin(), Infos.end(),
+                                   [&id](const BackendInformation::Ptr& info) { return info->Id() == id; });
+      return it != Infos.end() && CAP_TYPE_FILE == ((*it)->Capabilities() & CAP_TYPE_MASK);
+    }
+
     BackendWorkerFactory::Ptr FindFactory(const String& id) const
     {
       const std::vector<FactoryWithId>::const_iterator it = std::find(Factories.begin(), Factories.end(), id);
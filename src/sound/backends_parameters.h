@@ -110,6 +110,11 @@ namespace Parameters
           const IntType LATENCY_DEFAULT = 100;
           //! Latency in mS
           const auto LATENCY = PREFIX + "latency"_id;
+
+          //! Default value
+          const IntType MMAP_DEFAULT = 0;
+          //! Use memory-mapped period-driven output
+          const auto MMAP = PREFIX + "mmap"_id;
           //@}
         }  // namespace Alsa
 
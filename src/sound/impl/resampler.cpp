@@ -13,6 +13,7 @@
 #include <make_ptr.h>
 #include <xrange.h>
 // library includes
+#include <debug/trace.h>
 #include <sound/resampler.h>
 
 extern "C"
@@ -23,6 +24,8 @@ extern "C"
 
 namespace Sound
 {
+  const Debug::Trace::Scope ResampleScope("Sound::Resample");
+
   class CubicCore
   {
   public:
@@ -113,6 +116,7 @@ namespace Sound
 
     Chunk Apply(Chunk in) override
     {
+      const Debug::Trace::Span span(ResampleScope);
       return Core.Apply(std::move(in));
     }
 
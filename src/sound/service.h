@@ -17,6 +17,9 @@
 
 namespace Sound
 {
+  //! Delimiter for several file backends to be used at once
+  const Char BACKENDS_DELIMITER = ',';
+
   class Service
   {
   public:
@@ -31,7 +34,8 @@ namespace Sound
     virtual Strings::Array GetAvailableBackends() const = 0;
 
     //! @brief Create backend using specified parameters
-    //! @param params %Backend-related parameters
+    //! @param backendId %Backend identifier or several file backends identifiers delimited by BACKENDS_DELIMITER.
+    //!        In the last case module is rendered once for all the backends
     //! @return Result backend
     //! @throw Error in case of error
     virtual Backend::Ptr CreateBackend(const String& backendId, Module::Holder::Ptr module,
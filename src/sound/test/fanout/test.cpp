@@ -0,0 +1,154 @@
+/**
+ *
+ * @file
+ *
+ * @brief  File backends fanout test
+ *
+ * @author vitamin.caig@gmail.com
+ *
+ **/
+
+#include "sound/backends/file_backend.h"
+#include <error_tools.h>
+#include <iostream>
+#include <memory>
+
+#define FILE_TAG 2F1A6C3D
+
+namespace
+{
+  class DummyState : public Module::State
+  {
+  public:
+    Time::AtMillisecond At() const override
+    {
+      return {};
+    }
+
+    Time::Milliseconds Total() const override
+    {
+      return {};
+    }
+
+    uint_t LoopCount() const override
+    {
+      return 0;
+    }
+  };
+
+  // Records all the calls and modifies received data like encoders do
+  class RecordingWorker : public Sound::BackendWorker
+  {
+  public:
+    void Startup() override
+    {
+      Events += 'S';
+    }
+
+    void Shutdown() override
+    {
+      Events += 'E';
+    }
+
+    void Pause() override
+    {
+      Events += 'P';
+    }
+
+    void Resume() override
+    {
+      Events += 'R';
+    }
+
+    void FrameStart(const Module::State& /*state*/) override
+    {
+      Events += 'f';
+    }
+
+    void FrameFinish(Sound::Chunk buffer) override
+    {
+      Events += 'F';
+      Data.insert(Data.end(), buffer.begin(), buffer.end());
+      buffer.ToS16();
+      std::fill(buffer.begin(), buffer.end(), Sound::Sample());
+    }
+
+    Sound::VolumeControl::Ptr GetVolumeControl() const override
+    {
+      return {};
+    }
+
+    String Events;
+    std::vector<Sound::Sample> Data;
+  };
+
+  void Check(bool condition, const String& msg)
+  {
+    if (!condition)
+    {
+      throw MakeFormattedError(THIS_LINE, "Failed: {}", msg);
+    }
+    std::cout << "Passed: " << msg << std::endl;
+  }
+
+  Sound::Chunk MakeChunk(std::size_t size, int_t seed)
+  {
+    Sound::Chunk result(size);
+    for (auto& smp : result)
+    {
+      smp = Sound::Sample(seed, -seed);
+      seed = (seed * 1103515245 + 12345) & 0x7fff;
+    }
+    return result;
+  }
+
+  void TestFanout(std::size_t count)
+  {
+    std::cout << "Test for " << count << " workers" << std::endl;
+    std::vector<std::shared_ptr<RecordingWorker>> workers;
+    std::vector<Sound::BackendWorker::Ptr> targets;
+    for (std::size_t idx = 0; idx != count; ++idx)
+    {
+      workers.push_back(std::make_shared<RecordingWorker>());
+      targets.push_back(workers.back());
+    }
+    const auto fanout = Sound::CreateFileBackendsFanoutWorker(std::move(targets));
+    std::vector<Sound::Sample> reference;
+    const DummyState state;
+    fanout->Startup();
+    fanout->Pause();
+    fanout->Resume();
+    for (int_t frame = 1; frame != 10; ++frame)
+    {
+      auto chunk = MakeChunk(frame * 100, frame);
+      reference.insert(reference.end(), chunk.begin(), chunk.end());
+      fanout->FrameStart(state);
+      fanout->FrameFinish(std::move(chunk));
+    }
+    fanout->Shutdown();
+    Check(!fanout->GetVolumeControl(), "no volume control");
+    for (const auto& worker : workers)
+    {
+      Check(worker->Events == "SfFfFfFfFfFfFfFfFfFE", "events order");
+      Check(worker->Data == reference, "data");
+    }
+  }
+}  // namespace
+
+int main()
+{
+  try
+  {
+    TestFanout(1);
+    TestFanout(4);
+    std::cout << " Succeed!" << std::endl;
+    return 0;
+  }
+  catch (const Error& e)
+  {
+    std::cerr << e.ToString();
+    return 1;
+  }
+}
+
+#undef FILE_TAG